@@ -5,6 +5,10 @@
  *
  * Tryout for streaming divide.
  * First with constant divisor, then try to automate the manual coefficients
+ *
+ * @date 2026-10-16 22:35:51
+ *
+ * Automated by `DIVCONST` in `srun3.cc`, which derives these schedules from the period of `1/divisor`.
  */
 
 #include <stdint.h>
@@ -49,13 +49,117 @@
  *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <pthread.h>
 #include <signal.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
 
-// maximum runlength before escaping
-#define RUNN 3
+/*
+ * @date 2026-10-16 16:10:04
+ *
+ * Decoder entry for a group of 8 raw bits.
+ *
+ * Each entry is the outcome of feeding 8 raw bits into the bit-serial state machine of `INBIT`.
+ * The table row holds the state at entry: number of consecutive same-polarity bits (0 to RUNN) and the polarity.
+ * The entry holds the state at exit, the decoded payload and how many raw bits were actually consumed.
+ * Consumption stops early at the end-of-sequence marker, the raw bits behind it belong to whatever follows.
+ *
+ * @typedef {object} DECODEBYTE
+ */
+struct DECODEBYTE {
+	unsigned char data;   // decoded payload bits, LSB first
+	unsigned char count;  // number of payload bits in `data`
+	unsigned char length; // number of raw bits consumed. 8 unless end-of-sequence reached
+	unsigned char next;   // row for next lookup: `runlength << 1 | polarity`. `EOS` when end-of-sequence reached
+
+	enum {
+		EOS = 0x80, // flag within `next`
+	};
+};
+
+/*
+ * @date 2026-10-16 16:10:04
+ *
+ * Lookup table to decode 8 raw bits per step.
+ *
+ * The entries are generated by running the rules of `INBIT::nextbit()` on every combination.
+ * Row 0 (no bits processed, polarity "0") is the state after `INBIT::start()`.
+ *
+ * @date 2026-10-16 18:25:31
+ *
+ * Generated at compile-time for each runlength.
+ *
+ * @typedef {object} DECODETAB
+ */
+template<unsigned RUNN>
+struct DECODETAB {
+
+	DECODEBYTE tab[(RUNN + 1) * 2][256];
+
+	constexpr DECODETAB() : tab() {
+		for (unsigned row = 0; row < (RUNN + 1) * 2; row++) {
+			for (unsigned raw = 0; raw < 256; raw++) {
+				unsigned runlength = row >> 1; // consecutive same-polarity bits
+				unsigned bit = row & 1; // current polarity
+				unsigned data = 0, count = 0, length = 0;
+				bool eos = false;
+
+				while (length < 8) {
+					unsigned t = (raw >> length++) & 1;
+
+					if (runlength == RUNN) {
+						// ARMED, next bit same = EOS, next bit opposite = escape
+						if (t == bit) {
+							eos = true;
+							break;
+						}
+						bit ^= 1; // mandatory polarity switch
+						runlength = 1; // escape is first of run
+						continue;
+					}
+
+					// payload bit
+					runlength = (t == bit) ? runlength + 1 : 1;
+					bit = t;
+					data |= t << count++;
+				}
+
+				DECODEBYTE *pEntry = &tab[row][raw];
+				pEntry->data = data;
+				pEntry->count = count;
+				pEntry->length = length;
+				pEntry->next = (eos ? DECODEBYTE::EOS : 0) | runlength << 1 | bit;
+			}
+		}
+	}
+};
+
+template<unsigned RUNN>
+constexpr DECODETAB<RUNN> decodeTab = DECODETAB<RUNN>();
+
+/*
+ * @date 2026-10-16 18:58:44
+ *
+ * Load 64 raw bits starting at any bit position
+ *
+ * NOTE: Memory is accessed as little-endian words, reads 9 bytes.
+ */
+static inline uint64_t loadraw(const unsigned char *pBase, uint64_t pos) {
+	const unsigned char *p = pBase + (pos >> 3);
+	unsigned shift = pos & 7;
+	uint64_t word;
+
+	memcpy(&word, p, sizeof word);
+
+	// NOTE: double shift as shifting by 64 is undefined
+	return word >> shift | (uint64_t) p[8] << 1 << (63 - shift);
+}
 
 /*
  * @date  2020-07-12 22:58:38
@@ -75,10 +179,18 @@
  * Otherwise mandatory flip polarity.
  * The flip counts as length 1.
  * 
+ * @date 2026-10-16 18:25:31
+ *
+ * Templated on the maximum runlength `RUNN` before escaping.
+ * Streams with different runlengths can coexist, each with its own specialised code.
+ *
  * @typedef {object} INBIT
  */
+template<unsigned RUNN>
 struct INBIT {
 
+	static_assert(RUNN >= 2 && RUNN <= 8, "runlength out of range");
+
 	/*
 	 * @date  2020-07-12 23:00:59
 	 * 
@@ -184,6 +296,16 @@ struct INBIT {
 		return t;
 	}
 
+	/*
+	 * @date 2026-10-16 16:24:10
+	 *
+	 * Return current position of bit/sequential memory
+	 */
+	unsigned getpos(void) {
+		// bit offset = byte offset * 8 + countTrailingZero(mask)
+		return (this->pMem - this->pBase) * 8 + __builtin_ctz(mask);
+	}
+
 	/*
 	 * @date 2020-07-12 23:57:22
 	 * 
@@ -229,7 +351,7 @@ struct INBIT {
 	 * @param {number} bitpos - bit-position
 	 * @return {int64_t} - The decoded value as variable length structure. For demonstration purpose assuming it will fit in less that 64 bits.
 	 */
-	inline int64_t decode(unsigned pos) {
+	inline int64_t decodeSerial(unsigned pos) {
 		int64_t num = 0; // fixed-width number being decoded
 		unsigned numlen = 0; // length of fixed-width `num` in bits
 
@@ -244,760 +366,7770 @@ struct INBIT {
 		} while (state);
 
 		// fill upper bits of resulting fixed-width number with polarity of end-of-sequence
-		num |= -((uint64_t) bit << numlen);
+		if (numlen < 64)
+			num |= -((uint64_t) bit << numlen);
 
 		return num;
 	}
 
-};
+	/**
+	 * @date 2026-10-16 16:18:47
+	 *
+	 * Table-driven decode, 8 raw bits per step.
+	 * Produces the same value and leaves the port in the same state as `decodeSerial()`.
+	 *
+	 * NOTE: reads one byte beyond the byte containing the end-of-sequence marker.
+	 *
+	 * @param {number} pos - bit-position
+	 * @return {int64_t} - The decoded value. For demonstration purpose assuming it will fit in less that 64 bits.
+	 */
+	inline int64_t decode(unsigned pos) {
+		uint64_t num = 0; // fixed-width number being decoded
+		unsigned numlen = 0; // length of fixed-width `num` in bits
+		unsigned row = 0; // decoder state as table row, same as `start()`
 
-/*
- * @date 2020-07-14 01:08:08
- * 
- * State context/namespace to write sequential memory
- *
- * @typedef {object} OUTBIT
- */
-struct OUTBIT {
+		for (;;) {
+			// next 8 raw bits, starting at any bit position
+			const unsigned char *p = pBase + (pos >> 3);
+			unsigned raw = ((p[0] | p[1] << 8) >> (pos & 7)) & 0xff;
+
+			const DECODEBYTE &entry = decodeTab<RUNN>.tab[row][raw];
+
+			// append payload
+			if (numlen < 64)
+				num |= (uint64_t) entry.data << numlen;
+			numlen += entry.count;
+
+			pos += entry.length;
+			row = entry.next;
+
+			if (row & DECODEBYTE::EOS)
+				break;
+		}
+
+		// update port to reflect end-of-sequence
+		this->pMem = this->pBase + (pos >> 3);
+		this->mask = 1 << (pos & 7);
+		this->state = 0;
+		this->bit = row & 1;
+
+		// fill upper bits of resulting fixed-width number with polarity of end-of-sequence
+		if (numlen < 64)
+			num |= -((uint64_t) bit << numlen);
+
+		return num;
+	}
+
+	/**
+	 * @date 2026-10-16 18:58:44
+	 *
+	 * Skip value without decoding, 64 raw bits per step.
+	 * Leaves the port in the same state as `decode()`.
+	 *
+	 * Payload runs are at most RUNN raw bits long, an escape is the first bit of the next run.
+	 * The end-of-sequence marker is the first run of RUNN+1 same-polarity raw bits.
+	 * Windows overlap by RUNN bits to detect runs that cross window boundaries.
+	 *
+	 * NOTE: Reads 64-bit words, up to 9 bytes beyond the end-of-sequence marker.
+	 *
+	 * @param {number} pos - bit-position
+	 * @return {number} - position following end-of-sequence
+	 */
+	inline unsigned skip(unsigned pos) {
+		for (;;) {
+			uint64_t x = loadraw(pBase, pos);
+
+			// bits equal to their predecessor
+			uint64_t eq = ~(x ^ x << 1);
+
+			// last bit of RUNN+1 same-polarity bits, bit 0 has no predecessor in this window
+			uint64_t run = eq;
+			for (unsigned k = 1; k < RUNN; k++)
+				run &= eq << k;
+			run &= ~((1ULL << RUNN) - 1);
+
+			if (run) {
+				unsigned z = __builtin_ctzll(run);
+
+				// update port to reflect end-of-sequence
+				this->bit = (x >> z) & 1;
+				pos += z + 1;
+				break;
+			}
+
+			pos += 64 - RUNN;
+		}
+
+		this->pMem = this->pBase + (pos >> 3);
+		this->mask = 1 << (pos & 7);
+		this->state = 0;
+
+		return pos;
+	}
 
 	/*
-	 * @date 2020-07-14 01:10:00
-	 * 
-	 * State of port as a shift register containing a single bit. 
-	 * Starting at bit 0, the bit number indicates the number of consecutive same-polarity bits already written.
+	 * @date 2026-10-16 18:58:44
+	 *
+	 * Number of raw bits of the value at `pos`, including end-of-sequence marker
 	 */
-	unsigned state;
+	inline unsigned encodedLength(unsigned pos) {
+		return skip(pos) - pos;
+	}
 
 	/*
-	 * @date 2020-07-14 01:10:38
-	 * 
-	 * Value of last encoded bit written
-	 * Using `bool` to mark that it conceptually contains a single bit, independent of the implementation.
+	 * @date 2026-10-16 21:08:33
+	 *
+	 * Cheap length probe: test if the value at `pos` ends within the first 64 raw bits.
+	 * The payload then has at most 63 bits and the value fits in `int64_t`.
+	 * Same run detection as the first window of `skip()`.
+	 *
+	 * NOTE: Reads 9 bytes.
 	 */
-	bool bit;
+	inline bool fitsword(unsigned pos) {
+		uint64_t x = loadraw(pBase, pos);
+
+		// last bit of RUNN+1 same-polarity bits
+		uint64_t eq = ~(x ^ x << 1);
+		uint64_t run = eq;
+		for (unsigned k = 1; k < RUNN; k++)
+			run &= eq << k;
+
+		return (run & ~((1ULL << RUNN) - 1)) != 0;
+	}
 
 	/*
-	 * @date 2020-07-14 22:53:18
-	 * 
-	 * Memory base address. Addressing is relative to bit 0
+	 * @date 2026-10-16 21:08:33
+	 *
+	 * Leave port in the state after reaching end-of-sequence, for when the value was decoded by other means
+	 *
+	 * @param {number} pos - position following end-of-sequence
+	 * @param {boolean} polarity - polarity of end-of-sequence
 	 */
-	unsigned char *const pBase;
+	inline void stop(unsigned pos, bool polarity) {
+		this->pMem = this->pBase + (pos >> 3);
+		this->mask = 1 << (pos & 7);
+		this->state = 0;
+		this->bit = polarity;
+	}
+
+};
+
+/*
+ * @date 2026-10-16 20:47:15
+ *
+ * Input port delivering data in chunks instead of bits.
+ * Decodes word-wise with `decodeTab`, escapes removed. After end-of-sequence it delivers the polarity forever.
+ * Used where whole words of data are processed at once: the limb operators of `ALU` and the lanes of `SLICEALU`.
+ *
+ * NOTE: reads one byte beyond the byte containing the end-of-sequence marker.
+ *
+ * @typedef {object} INCHUNK
+ */
+template<unsigned RUNN>
+struct INCHUNK {
+
+	enum {
+		CHUNK = 56, // data bits per chunk, leaves room to decode a whole table entry in a 64-bit buffer
+	};
+
+	unsigned pos;     // bit-position of next raw bits
+	unsigned row;     // decoder state as `decodeTab` row
+	uint64_t pend;    // decoded data bits not yet consumed, LSB first
+	unsigned pendlen; // number of bits in `pend`
+	uint64_t fill;    // after end-of-sequence, all bits set to the polarity
+	unsigned total;   // number of data bits, final when `row` has `DECODEBYTE::EOS`
+	uint64_t history; // `refillPext()` only: last RUNN raw bits
+	uint64_t first;   // `refillPext()` only: mask of the first raw bit when it starts a run
 
 	/*
-	 * @date 2020-07-12 23:06:31
-	 * 
-	 * Memory is accessed as groups of 8 bit.
-	 * Pointer to current byte,
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * reset state and set address of first bit of sequential memory
 	 */
-	unsigned char *pMem;
+	inline void start(unsigned pos) {
+		this->pos = pos;
+		this->row = 0; // same as `INBIT::start()`
+		this->pend = 0;
+		this->pendlen = 0;
+		this->fill = 0;
+		this->total = 0;
+		this->history = 0x5555555555555555ULL & ((1ULL << RUNN) - 1); // alternating bits, no run
+		this->first = 1ULL << RUNN;
+	}
 
 	/*
-	 * @date 2020-07-14 01:11:24
-	 * 
-	 * Shift register containing bit to indicate active bit within the byte.
-	 * On each write the bit is left-rotated one position. 
-	 * On wrap, increment memory pointer to next position.
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * Decode until at least `CHUNK` data bits are pending, or end-of-sequence
 	 */
-	unsigned char mask;
+	inline void refill(const unsigned char *pBase) {
+		while (pendlen < CHUNK && !(row & DECODEBYTE::EOS)) {
+			// next 8 raw bits, starting at any bit position
+			const unsigned char *p = pBase + (pos >> 3);
+			unsigned raw = ((p[0] | p[1] << 8) >> (pos & 7)) & 0xff;
+
+			const DECODEBYTE &entry = decodeTab<RUNN>.tab[row][raw];
+
+			pend |= (uint64_t) entry.data << pendlen;
+			pendlen += entry.count;
+			total += entry.count;
+			pos += entry.length;
+			row = entry.next;
+		}
+
+		if (row & DECODEBYTE::EOS)
+			fill = -(uint64_t) (row & 1);
+	}
+
+#if defined(__x86_64__)
 
 	/*
-	 * @date 2020-07-14 01:11:37
-	 * 
-	 * Constructor/Initialise
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * Same as `refill()`, decoding up to 64 raw bits per step with the run detection of `INPEXT`.
+	 * The window is narrowed to what fits in `pend`.
+	 * `row` only reflects end-of-sequence and polarity, the run state is kept in `history`.
+	 *
+	 * NOTE: Reads 64-bit words, up to 9 bytes beyond the end-of-sequence marker.
 	 */
-	inline OUTBIT(unsigned char *pBase) : pBase(pBase) {
-		state = 0; // stop state
-		bit = 0; // last decoded bits
-		pMem = NULL; // Memory location is undefined
-		mask = 0x01; // Set a single bit
+	__attribute__((target("bmi2"))) inline void refillPext(const unsigned char *pBase) {
+		static constexpr uint64_t HISTORY = (1ULL << RUNN) - 1;
+
+		while (pendlen < CHUNK && !(row & DECODEBYTE::EOS)) {
+			// raw bits in window, at most what fits
+			unsigned width = 64 - pendlen < 64 - RUNN ? 64 - pendlen : 64 - RUNN;
+			uint64_t window = ((1ULL << width) - 1) << RUNN;
+
+			// history in the lower RUNN bits, followed by raw bits
+			uint64_t x = loadraw(pBase, pos) << RUNN | history;
+
+			// bits equal to their predecessor
+			uint64_t eq = ~(x ^ x << 1) & ~1ULL & ~first;
+
+			// bits following RUNN same-polarity bits
+			uint64_t run = eq;
+			for (unsigned k = 1; k < RUNN - 1; k++)
+				run &= eq << k;
+			run <<= 1;
+
+			uint64_t escape = run & ~eq & window;
+			uint64_t eos = run & eq & window;
+
+			uint64_t payload = ~escape & window;
+			if (eos) {
+				unsigned z = __builtin_ctzll(eos);
+
+				payload &= (1ULL << z) - 1;
+				row = DECODEBYTE::EOS | (x >> z & 1);
+				fill = -(x >> z & 1);
+				pos += z - RUNN + 1;
+			} else {
+				history = x >> width & HISTORY;
+				first = 0;
+				pos += width;
+			}
+
+			pend |= _pext_u64(x, payload) << pendlen;
+			unsigned count = __builtin_popcountll(payload);
+			pendlen += count;
+			total += count;
+		}
 	}
 
+#endif
+
 	/*
-	 * @date 2020-07-14 01:12:47
-	 * 
-	 * reset state and set address of first bit of sequential memory
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * Next 64 data bits, not consumed. At least `CHUNK` are valid after `refill()`
 	 */
-	inline void start(unsigned pos) {
-		this->bit = 0; // not emitted but well known initial value
-		this->pMem = pBase + (pos >> 3); // in which byte is active bit located
-		this->mask = 1 << (pos & 7); // set position of active bit;
-		this->state = 1; // state is nothing previously emitted (bit0 set)
+	inline uint64_t peek(void) {
+		return pendlen < 64 ? pend | fill << pendlen : pend;
 	}
 
 	/*
-	 * @date 2020-07-14 21:03:57
-	 * 
-	 * Return current position of bit/sequential memory
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * Consume `k` (less than 64) data bits
 	 */
-	unsigned getpos(void) {
-		// bit offset = byte offset * 8 + countTrailingZero(mask)
-		return (this->pMem - this->pBase) * 8 + __builtin_ctz(mask);
+	inline void consume(unsigned k) {
+		pend >>= k;
+		pendlen = pendlen > k ? pendlen - k : 0;
 	}
 
 	/*
-	 * @date 2020-07-14 20:32:49
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * Leave `port` in the state after reaching end-of-sequence, same as `INBIT::decode()`
 	 */
-	inline void emitraw(bool b) {
-		// set/clear memory bit
-		if (b)
-			*pMem |= mask;
-		else
-			*pMem &= ~mask;
+	inline void stop(INBIT<RUNN> &port) {
+		port.stop(pos, row & 1);
+	}
+};
 
-		// shift/rotate the bit in `mask` to mark next active bit
-		mask = mask << 1 | mask >> 7;
+#if defined(__x86_64__)
 
-		// When bit rotates, bump memory pointer
-		// do not use 'if (mask & 1) pMem++;` because that generates flow-control instructions
-		pMem += (mask & 1);
-	}
+/*
+ * @date 2026-10-16 17:40:26
+ *
+ * Decode kernel for x86-64 with BMI2.
+ *
+ * Decodes a 64-bit window of raw bits per step instead of one bit (`INBIT::nextbit()`) or one byte (`INBIT::decode()`).
+ * Within the raw bits, a run of RUNN same-polarity bits can only be followed by either
+ *   - an escape, the opposite polarity, which is not part of the payload.
+ *   - the end-of-sequence marker, the same polarity.
+ * The escape itself is the first bit of the next run.
+ * This makes runs detectable in parallel: mark bits equal to their predecessor, combine RUNN-1 shifted copies.
+ * `pext` compacts the payload by dropping the escape positions.
+ *
+ * The window contains RUNN bits of history to detect runs that cross window boundaries.
+ * The first window has a history of alternating bits, which never forms a run.
+ *
+ * NOTE: Reads 64-bit words, up to 9 bytes beyond the end-of-sequence marker.
+ *
+ * @typedef {object} INPEXT
+ */
+template<unsigned RUNN>
+struct INPEXT {
+
+	// mask of history bits in the window
+	static constexpr uint64_t HISTORY = (1ULL << RUNN) - 1;
 
 	/*
-	 * @date 2020-07-14 20:36:02
+	 * @date 2026-10-16 17:40:26
+	 *
+	 * Memory base address. Addressing is relative to bit 0
 	 */
-	inline void emitbit(bool b) {
-		// if end-of-sequence is armed, emit mandatory escape
-		if (state & (1 << RUNN)) {
-			bit ^= 1; // flip polarity
-			emitraw(bit); // emit polarity switch
-			state = 1 << 1; // state = 1 bit emitted
-		}
-
-		// emit bit
-		emitraw(b);
+	unsigned char *const pBase;
 
-		// bump state
-		state = bit ^ b
-			? 1 << 1 // switching polarity, 1 bit emitted
-			: state << 1; // shift active bit
+	/*
+	 * @date 2026-10-16 17:40:26
+	 *
+	 * Position following the last decoded end-of-sequence marker
+	 */
+	unsigned pos;
 
-		// remember last emitted bit
-		bit = b;
+	/*
+	 * @date 2026-10-16 17:40:26
+	 *
+	 * Constructor/Initialise
+	 */
+	inline INPEXT(unsigned char *pBase) : pBase(pBase) {
+		this->pos = 0;
 	}
 
 	/*
-	 * @date 2020-07-15 01:21:22
-	 * 
-	 * Emit an armed end-of-sequence marker
-	 * 
-	 * Repeat emitting `value` until maximum run-length reached.
-	 * This can generate 0 to RUNN-1 bits.
-	 * If `value` is opposite polarity then emit a complete marker.   
+	 * @date 2026-10-16 17:40:26
+	 *
+	 * Return current position of bit/sequential memory
 	 */
-	inline void emitEOSS(bool polarity) {
-		while (!(state & (1 << RUNN)) || bit != polarity)
-			emitbit(polarity);
+	unsigned getpos(void) {
+		return this->pos;
 	}
 
 	/**
-	 * Encode signed value
+	 * @date 2026-10-16 17:40:26
 	 *
-	 * @param {string} pDest - bit-addressable memory (LSB emitted first).
-	 * @param {number} bitpos - bit-position
-	 * @param {number} num - signed value
-	 * @return {number} - length including terminator.
+	 * Decode value starting at `pos`.
+	 *
+	 * @param {number} pos - bit-position
+	 * @return {int64_t} - The decoded value. For demonstration purpose assuming it will fit in less that 64 bits.
 	 */
-	inline void encode(unsigned pos, int64_t num) {
-		// start the engine
-		start(pos);
+	__attribute__((target("bmi2"))) int64_t decode(unsigned pos) {
+		uint64_t num = 0; // fixed-width number being decoded
+		unsigned numlen = 0; // length of fixed-width `num` in bits
+		uint64_t history = 0x5555555555555555ULL & HISTORY; // alternating bits, no run
+		uint64_t first = 1ULL << RUNN; // first raw bit starts a run
 
-		// as long as there are input bits
-		while (num != 0 && num != -1) {
-			// inject next LSB bit to output
-			emitbit(num & 1);
+		for (;;) {
+			// history in the lower RUNN bits, followed by raw bits
+			uint64_t x = loadraw(pBase, pos) << RUNN | history;
 
-			// bump binary decoding
-			num >>= 1; // NOTE: arithmetic shift leaves sign-bit untouched
-		}
+			// bits equal to their predecessor
+			uint64_t eq = ~(x ^ x << 1) & ~1ULL & ~first;
 
-		// end-of-sequence polarity
-		num &= 1;
+			// bits following RUNN same-polarity bits
+			uint64_t run = eq;
+			for (unsigned k = 1; k < RUNN - 1; k++)
+				run &= eq << k;
+			run <<= 1;
 
-		// Buildup leading bits until maximum run-length reached
-		emitEOSS(num);
+			// only consider raw bits, not history
+			uint64_t escape = run & ~eq & ~HISTORY;
+			uint64_t eos = run & eq & ~HISTORY;
 
-		// finalise end-of-sequence with same-polarity
-		emitraw(bit);
-	}
+			if (eos) {
+				// payload before end-of-sequence
+				unsigned z = __builtin_ctzll(eos);
+				uint64_t payload = ~escape & ((1ULL << z) - 1) & ~HISTORY;
 
-};
+				if (numlen < 64)
+					num |= _pext_u64(x, payload) << numlen;
+				numlen += __builtin_popcountll(payload);
 
+				// fill upper bits with polarity of end-of-sequence
+				if (numlen < 64)
+					num |= -((x >> z & 1) << numlen);
 
-// timer tick
-int tick = 0;
+				this->pos = pos + z - RUNN + 1;
+				return num;
+			}
 
-/**
- * @date 2020-07-15 00:52:43
- *
- * Operatore/instructions
- */
-struct ALU {
+			// complete window is payload
+			uint64_t payload = ~escape & ~HISTORY;
+
+			if (numlen < 64)
+				num |= _pext_u64(x, payload) << numlen;
+			numlen += __builtin_popcountll(payload);
+
+			history = x >> (64 - RUNN);
+			first = 0;
+			pos += 64 - RUNN;
+		}
+	}
+};
+
+/*
+ * @date 2026-10-16 20:02:39
+ *
+ * Refill order of finished lanes: for each lane mask, the rank of each set lane among the set lanes
+ *
+ * @typedef {object} REFILLRANK
+ */
+struct REFILLRANK {
+
+	unsigned char rank[256][8];
+
+	constexpr REFILLRANK() : rank() {
+		for (unsigned mask = 0; mask < 256; mask++) {
+			unsigned r = 0;
+			for (unsigned l = 0; l < 8; l++) {
+				if (mask & (1 << l))
+					rank[mask][l] = r++;
+			}
+		}
+	}
+};
+
+constexpr REFILLRANK refillRank = REFILLRANK();
+
+/*
+ * @date 2026-10-16 20:02:39
+ *
+ * Batch decoder for values at scattered positions, x86-64 with AVX2.
+ *
+ * Runs 8 independent table-driven decoders (`INBIT::decode()`) in lockstep, structure-of-arrays.
+ * Each lane holds position, table row and the 64-bit value being decoded as two 32-bit halves.
+ * A step gathers 8 raw bytes from memory and 8 `DECODEBYTE` entries from the table.
+ * Lanes that reach end-of-sequence are finalised and refilled with the next position of the work queue,
+ * so memory latency of one lane overlaps with the work of the others.
+ *
+ * NOTE: Reads 32-bit words, up to 4 bytes beyond the end-of-sequence marker.
+ *
+ * @typedef {object} INGATHER
+ */
+template<unsigned RUNN>
+struct INGATHER {
+
+	enum {
+		LANES = 8,
+		MAXJOBS = 0x7fffffff - LANES, // job indices are signed 32-bit lanes, including those of the refill
+	};
+
+	/*
+	 * @date 2026-10-16 20:02:39
+	 *
+	 * Memory base address. Addressing is relative to bit 0
+	 */
+	unsigned char *const pBase;
+
+	/*
+	 * @date 2026-10-16 20:02:39
+	 *
+	 * Constructor/Initialise
+	 */
+	inline INGATHER(unsigned char *pBase) : pBase(pBase) {
+	}
+
+	/**
+	 * @date 2026-10-16 20:02:39
+	 *
+	 * Decode values at `pPos[0..n-1]`
+	 *
+	 * @param {number[]} pPos - bit-positions, the work queue
+	 * @param {number} n - number of values
+	 * @param {int64_t[]} pNum - decoded values
+	 * @param {number[]} pEnd - optional, positions following the end-of-sequence markers
+	 *
+	 * @date 2026-10-17 02:52:14
+	 *
+	 * Job indices are kept in signed 32-bit lanes, batches of more than `MAXJOBS` values are decoded in slices.
+	 */
+	__attribute__((target("avx2"))) void decode(const unsigned *pPos, size_t n, int64_t *pNum, unsigned *pEnd) {
+		while (n > MAXJOBS) {
+			decode(pPos, MAXJOBS, pNum, pEnd);
+			pPos += MAXJOBS;
+			pNum += MAXJOBS;
+			if (pEnd)
+				pEnd += MAXJOBS;
+			n -= MAXJOBS;
+		}
+
+		alignas(32) uint32_t laneLo[LANES], laneHi[LANES], laneLen[LANES], laneRow[LANES], lanePos[LANES], laneJob[LANES];
+
+		const int *pTab = (const int *) &decodeTab<RUNN>.tab[0][0];
+		const __m256i m7 = _mm256_set1_epi32(7);
+		const __m256i mff = _mm256_set1_epi32(0xff);
+		const __m256i c32 = _mm256_set1_epi32(32);
+		const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+		// lanes take the first jobs, lanes without job are frozen at a harmless position
+		__m256i job = lanes;
+		__m256i live = _mm256_cmpgt_epi32(_mm256_set1_epi32(n < LANES ? n : (size_t) LANES), lanes);
+		__m256i pos = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *) pPos, job, live, 4);
+		__m256i row = _mm256_setzero_si256();
+		__m256i lo = _mm256_setzero_si256();
+		__m256i hi = _mm256_setzero_si256();
+		__m256i len = _mm256_setzero_si256();
+		size_t next = LANES; // next job from queue
+
+		while (!_mm256_testz_si256(live, live)) {
+			// next 8 raw bits of each lane, starting at any bit position
+			__m256i word = _mm256_i32gather_epi32((const int *) pBase, _mm256_srli_epi32(pos, 3), 1);
+			__m256i raw = _mm256_and_si256(_mm256_srlv_epi32(word, _mm256_and_si256(pos, m7)), mff);
+
+			// `DECODEBYTE` as little-endian word: data | count << 8 | length << 16 | next << 24
+			__m256i entry = _mm256_i32gather_epi32(pTab, _mm256_or_si256(_mm256_slli_epi32(row, 8), raw), 4);
+			__m256i data = _mm256_and_si256(entry, mff);
+			__m256i count = _mm256_and_si256(_mm256_srli_epi32(entry, 8), mff);
+			__m256i length = _mm256_and_si256(_mm256_srli_epi32(entry, 16), mff);
+
+			// append payload, shifts of 32 or more yield zero
+			lo = _mm256_or_si256(lo, _mm256_sllv_epi32(data, len));
+			hi = _mm256_or_si256(hi, _mm256_sllv_epi32(data, _mm256_sub_epi32(len, c32)));
+			hi = _mm256_or_si256(hi, _mm256_srlv_epi32(data, _mm256_sub_epi32(c32, len)));
+			len = _mm256_add_epi32(len, count);
+
+			// only live lanes advance
+			pos = _mm256_add_epi32(pos, _mm256_and_si256(length, live));
+			row = _mm256_and_si256(_mm256_srli_epi32(entry, 24), _mm256_set1_epi32(~DECODEBYTE::EOS & 0xff));
+
+			// lanes reaching end-of-sequence, `DECODEBYTE::EOS` is the sign bit
+			__m256i done = _mm256_srai_epi32(_mm256_and_si256(entry, live), 31);
+			unsigned eos = _mm256_movemask_ps(_mm256_castsi256_ps(done));
+			if (!eos)
+				continue;
+
+			// output finished lanes
+			_mm256_store_si256((__m256i *) laneLo, lo);
+			_mm256_store_si256((__m256i *) laneHi, hi);
+			_mm256_store_si256((__m256i *) laneLen, len);
+			_mm256_store_si256((__m256i *) laneRow, row);
+			_mm256_store_si256((__m256i *) lanePos, pos);
+			_mm256_store_si256((__m256i *) laneJob, job);
+
+			for (unsigned m = eos; m; m &= m - 1) {
+				unsigned l = __builtin_ctz(m);
+
+				// fill upper bits of resulting fixed-width number with polarity of end-of-sequence
+				uint64_t num = (uint64_t) laneHi[l] << 32 | laneLo[l];
+				if (laneLen[l] < 64)
+					num |= -((uint64_t) (laneRow[l] & 1) << laneLen[l]);
+
+				pNum[laneJob[l]] = num;
+				if (pEnd)
+					pEnd[laneJob[l]] = lanePos[l];
+			}
+
+			// refill finished lanes in lane order with the next jobs
+			__m256i rank = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) refillRank.rank[eos]));
+			__m256i newJob = _mm256_add_epi32(_mm256_set1_epi32(next), rank);
+			__m256i refill = _mm256_and_si256(done, _mm256_cmpgt_epi32(_mm256_set1_epi32(n), newJob));
+			next += __builtin_popcount(eos);
+
+			job = _mm256_blendv_epi8(job, newJob, done);
+			pos = _mm256_mask_i32gather_epi32(pos, (const int *) pPos, newJob, refill, 4);
+			live = _mm256_or_si256(_mm256_andnot_si256(done, live), refill);
+			row = _mm256_andnot_si256(done, row);
+			lo = _mm256_andnot_si256(done, lo);
+			hi = _mm256_andnot_si256(done, hi);
+			len = _mm256_andnot_si256(done, len);
+		}
+	}
+};
+
+#endif
+
+/*
+ * @date 2026-10-17 02:09:41
+ *
+ * Length entry for a group of up to 7 payload bits.
+ *
+ * Each entry is the outcome of feeding the payload bits into the escape rules of `OUTBIT::emitbit()`.
+ * The table row holds the state at entry: number of consecutive same-polarity bits (0 to RUNN) and the polarity.
+ * The column is the payload bits with a leading "1" above them that marks how many there are.
+ *
+ * @typedef {object} LENGTHBYTE
+ */
+struct LENGTHBYTE {
+	unsigned char escapes; // number of escapes emitted
+	unsigned char next;    // row for next lookup: `runlength << 1 | polarity`
+};
+
+/*
+ * @date 2026-10-17 02:09:41
+ *
+ * Lookup table to count escapes of 7 payload bits per step, and of the 0 to 6 remaining.
+ * Row 0 (no bits emitted, polarity "0") is the state of a fresh run.
+ *
+ * @typedef {object} LENGTHTAB
+ */
+template<unsigned RUNN>
+struct LENGTHTAB {
+
+	LENGTHBYTE tab[(RUNN + 1) * 2][256];
+
+	constexpr LENGTHTAB() : tab() {
+		for (unsigned row = 0; row < (RUNN + 1) * 2; row++) {
+			for (unsigned column = 1; column < 256; column++) {
+				unsigned runlength = row >> 1; // consecutive same-polarity bits
+				unsigned bit = row & 1; // current polarity
+				unsigned escapes = 0;
+
+				// payload bits are below the leading "1"
+				unsigned count = 7;
+				while (!(column >> count & 1))
+					count--;
+
+				for (unsigned i = 0; i < count; i++) {
+					unsigned b = (column >> i) & 1;
+
+					if (runlength == RUNN) {
+						// mandatory escape
+						bit ^= 1;
+						runlength = 1;
+						escapes++;
+					}
+
+					runlength = (b == bit) ? runlength + 1 : 1;
+					bit = b;
+				}
+
+				LENGTHBYTE *pEntry = &tab[row][column];
+				pEntry->escapes = escapes;
+				pEntry->next = runlength << 1 | bit;
+			}
+		}
+	}
+};
+
+template<unsigned RUNN>
+constexpr LENGTHTAB<RUNN> lengthTab = LENGTHTAB<RUNN>();
+
+/*
+ * @date 2020-07-14 01:08:08
+ * 
+ * State context/namespace to write sequential memory
+ *
+ * @date 2026-10-16 18:25:31
+ *
+ * Templated on the maximum runlength `RUNN` before escaping.
+ *
+ * @typedef {object} OUTBIT
+ */
+template<unsigned RUNN>
+struct OUTBIT {
+
+	static_assert(RUNN >= 2 && RUNN <= 8, "runlength out of range");
+
+	/*
+	 * @date 2020-07-14 01:10:00
+	 * 
+	 * State of port as a shift register containing a single bit. 
+	 * Starting at bit 0, the bit number indicates the number of consecutive same-polarity bits already written.
+	 */
+	unsigned state;
+
+	/*
+	 * @date 2020-07-14 01:10:38
+	 * 
+	 * Value of last encoded bit written
+	 * Using `bool` to mark that it conceptually contains a single bit, independent of the implementation.
+	 */
+	bool bit;
+
+	/*
+	 * @date 2020-07-14 22:53:18
+	 * 
+	 * Memory base address. Addressing is relative to bit 0
+	 */
+	unsigned char *const pBase;
+
+	/*
+	 * @date 2026-10-16 17:12:08
+	 *
+	 * Memory is written as groups of 64 bit.
+	 * Pointer to the first byte of `word`.
+	 */
+	unsigned char *pMem;
+
+	/*
+	 * @date 2026-10-16 17:12:08
+	 *
+	 * Write-combining register.
+	 * Collects bits, LSB first, until a full word can be written to `pMem`.
+	 * This avoids a read-modify-write of memory for every bit, and the stalls of reading back a freshly written byte.
+	 * The register starts at a byte boundary, bits of the first byte that precede the start position are preloaded.
+	 */
+	uint64_t word;
+
+	/*
+	 * @date 2026-10-16 17:12:08
+	 *
+	 * Number of bits in `word`. Always less than 64.
+	 */
+	unsigned wordlen;
+
+	/*
+	 * @date 2020-07-14 01:11:37
+	 * 
+	 * Constructor/Initialise
+	 */
+	inline OUTBIT(unsigned char *pBase) : pBase(pBase) {
+		state = 0; // stop state
+		bit = 0; // last decoded bits
+		pMem = NULL; // Memory location is undefined
+		word = 0; // nothing collected
+		wordlen = 0;
+	}
+
+	/*
+	 * @date 2020-07-14 01:12:47
+	 * 
+	 * reset state and set address of first bit of sequential memory
+	 *
+	 * NOTE: Pending bits of a previous sequence are discarded, `flush()` it first.
+	 */
+	inline void start(unsigned pos) {
+		this->bit = 0; // not emitted but well known initial value
+		this->pMem = pBase + (pos >> 3); // in which byte is first bit located
+		this->wordlen = pos & 7; // set position of first bit
+		this->word = *this->pMem & ((1 << this->wordlen) - 1); // preserve preceding bits of first byte
+		this->state = 1; // state is nothing previously emitted (bit0 set)
+	}
+
+	/*
+	 * @date 2020-07-14 21:03:57
+	 * 
+	 * Return current position of bit/sequential memory
+	 * This includes the bits that are not yet flushed to memory.
+	 */
+	unsigned getpos(void) {
+		// bit offset = byte offset * 8 + bits collected
+		return (this->pMem - this->pBase) * 8 + this->wordlen;
+	}
+
+	/*
+	 * @date 2026-10-16 17:12:08
+	 *
+	 * Write collected bits to memory. Bits beyond the current position are preserved.
+	 * Sequential memory is only complete after a flush. The port can continue emitting afterwards.
+	 *
+	 * NOTE: Memory is accessed as little-endian words, matching the LSB-first bit order within bytes.
+	 * NOTE: The word access touches up to 8 bytes beyond the last written bit. Memory needs that as padding.
+	 */
+	inline void flush(void) {
+		uint64_t m = (1ULL << wordlen) - 1; // bits to be written
+
+		// merge with memory
+		uint64_t w;
+		memcpy(&w, pMem, sizeof w);
+		w = (w & ~m) | (word & m);
+		memcpy(pMem, &w, sizeof w);
+	}
+
+	/*
+	 * @date 2020-07-14 20:32:49
+	 */
+	inline void emitraw(bool b) {
+		// collect bit
+		word |= (uint64_t) b << wordlen;
+
+		// write when full
+		if (++wordlen == 64) {
+			memcpy(pMem, &word, sizeof word);
+			pMem += sizeof word;
+			word = 0;
+			wordlen = 0;
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 16:41:55
+	 *
+	 * Emit `n` (0-64) raw bits, LSB first.
+	 */
+	inline void emitword(uint64_t bits, unsigned n) {
+		if (n < 64)
+			bits &= (1ULL << n) - 1;
+
+		// collect bits
+		word |= bits << wordlen;
+
+		// write when full, keep what did not fit
+		if (wordlen + n >= 64) {
+			memcpy(pMem, &word, sizeof word);
+			pMem += sizeof word;
+			word = wordlen ? bits >> (64 - wordlen) : 0;
+			wordlen = wordlen + n - 64;
+		} else {
+			wordlen += n;
+		}
+	}
+
+	/*
+	 * @date 2020-07-14 20:36:02
+	 */
+	inline void emitbit(bool b) {
+		// if end-of-sequence is armed, emit mandatory escape
+		if (state & (1 << RUNN)) {
+			bit ^= 1; // flip polarity
+			emitraw(bit); // emit polarity switch
+			state = 1 << 1; // state = 1 bit emitted
+		}
+
+		// emit bit
+		emitraw(b);
+
+		// bump state
+		state = bit ^ b
+			? 1 << 1 // switching polarity, 1 bit emitted
+			: state << 1; // shift active bit
+
+		// remember last emitted bit
+		bit = b;
+	}
+
+	/*
+	 * @date 2020-07-15 01:21:22
+	 * 
+	 * Emit an armed end-of-sequence marker
+	 * 
+	 * Repeat emitting `value` until maximum run-length reached.
+	 * This can generate 0 to RUNN-1 bits.
+	 * If `value` is opposite polarity then emit a complete marker.   
+	 */
+	inline void emitEOSS(bool polarity) {
+		while (!(state & (1 << RUNN)) || bit != polarity)
+			emitbit(polarity);
+	}
+
+	/*
+	 * @date 2026-10-16 16:47:30
+	 *
+	 * Emit `count` (0-63) payload bits, LSB first. Same result as `count` times `emitbit()`.
+	 *
+	 * Instead of testing the runlength per bit, locate where the escapes are needed and copy everything in between as a whole.
+	 * `eq` marks the bits that have the same polarity as their predecessor.
+	 * A run of RUNN same-polarity bits ends where RUNN-1 consecutive `eq` are set.
+	 * An escape breaks the run, data runs are only valid when starting after the last escape.
+	 * The run continuing from previous bits (or from the escape) is a plain count of leading same-polarity bits.
+	 */
+	inline void emitdata(uint64_t data, unsigned count) {
+		// data runs need RUNN bits of data, they can not end in the first RUNN-1 positions
+		static constexpr uint64_t DATARUN = (1ULL << (RUNN - 1)) - 1;
+
+		unsigned runlength = __builtin_ctz(state); // consecutive same-polarity bits already emitted
+		unsigned last = bit; // polarity of last emitted bit
+
+		if (!count)
+			return;
+
+		// end positions of runs of RUNN within the data, `eq` bit 0 has no predecessor
+		uint64_t valid = (1ULL << count) - 1;
+		uint64_t eq = ~(data ^ data << 1) & valid & ~1ULL;
+		uint64_t run = eq;
+		for (unsigned k = 1; k < RUNN - 1; k++)
+			run &= eq << k;
+
+		// if end-of-sequence is armed, emit mandatory escape
+		if (runlength == RUNN) {
+			last ^= 1; // flip polarity
+			emitword(last, 1); // emit polarity switch
+			runlength = 1;
+		}
+
+		for (;;) {
+			// data runs starting at the current position or later
+			uint64_t next = run & ~DATARUN;
+
+			// run continuing from previous bits
+			unsigned head = __builtin_ctzll((data ^ -(uint64_t) last) | ~valid);
+			if (head >= RUNN - runlength)
+				next |= 1ULL << (RUNN - runlength - 1);
+
+			if (!next)
+				break;
+
+			// data bits up to including where runlength is reached
+			unsigned n = __builtin_ctzll(next) + 1;
+			last = (data >> (n - 1)) & 1;
+
+			if (n == count) {
+				// escape is postponed until more data arrives
+				emitword(data, n);
+				runlength = RUNN;
+				state = 1 << runlength;
+				bit = last;
+				return;
+			}
+
+			// emit segment including mandatory escape
+			last ^= 1;
+			emitword((data & ((1ULL << n) - 1)) | (uint64_t) last << n, n + 1);
+			runlength = 1; // escape is first of run
+
+			// shift to next position
+			data >>= n;
+			valid >>= n;
+			run >>= n;
+			count -= n;
+		}
+
+		// remaining data needs no escapes, determine runlength of trailing bits
+		unsigned top = (data >> (count - 1)) & 1;
+		uint64_t diff = (data ^ -(uint64_t) top) & valid;
+
+		if (diff)
+			runlength = count - 1 - (63 - __builtin_clzll(diff));
+		else if (top == last)
+			runlength += count;
+		else
+			runlength = count;
+
+		emitword(data, count);
+		state = 1 << runlength;
+		bit = top;
+	}
+
+	/**
+	 * @date 2026-10-16 19:41:26
+	 *
+	 * Emit a complete value including end-of-sequence marker, without flushing.
+	 * The value starts a fresh run, as if the engine was just started.
+	 *
+	 * @param {number} num - signed value
+	 */
+	inline void emitvalue(int64_t num) {
+		// fresh run
+		bit = 0;
+		state = 1;
+
+		// number of bits before only sign bits remain
+		unsigned count = 63 - __builtin_clrsbll(num);
+
+		// inject data bits to output
+		emitdata(num, count);
+
+		// end-of-sequence polarity
+		bool polarity = num < 0;
+
+		/*
+		 * Buildup leading bits until maximum run-length reached and finalise with same-polarity.
+		 * Continuing a run of same polarity needs to complete it, any other situation needs a full run.
+		 * An armed opposite polarity will have the mandatory escape merge into the marker.
+		 */
+		unsigned runlength = __builtin_ctz(state);
+		unsigned length = (bit == polarity ? RUNN - runlength : RUNN) + 1;
+
+		emitword(-(uint64_t) polarity, length);
+
+		// end-of-sequence leaves the marker armed
+		bit = polarity;
+		state = 1 << RUNN;
+	}
+
+	/**
+	 * @date 2026-10-16 16:47:30
+	 *
+	 * Encode signed value, word-at-a-time.
+	 * Produces the same bits as `encodeSerial()`.
+	 *
+	 * @param {number} pos - bit-position
+	 * @param {number} num - signed value
+	 */
+	inline void encode(unsigned pos, int64_t num) {
+		// start the engine
+		start(pos);
+
+		// inject value
+		emitvalue(num);
+
+		// write to memory
+		flush();
+	}
+
+	/**
+	 * @date 2026-10-16 19:41:26
+	 *
+	 * Encode array of signed values as a contiguous stream.
+	 * Same bits as calling `encode()` for each value at the position following the previous,
+	 * with a single start and flush and memory written as whole words.
+	 *
+	 * @param {number} pos - bit-position
+	 * @param {int64_t[]} pNum - values
+	 * @param {number} n - number of values
+	 * @param {number[]} pOffsets - optional, receives the start position of each value
+	 * @return {number} - position following the last end-of-sequence marker
+	 */
+	inline unsigned encodeBatch(unsigned pos, const int64_t *pNum, size_t n, unsigned *pOffsets) {
+		// start the engine
+		start(pos);
+
+		if (pOffsets) {
+			for (size_t i = 0; i < n; i++) {
+				pOffsets[i] = getpos();
+				emitvalue(pNum[i]);
+			}
+		} else {
+			for (size_t i = 0; i < n; i++)
+				emitvalue(pNum[i]);
+		}
+
+		// write to memory
+		flush();
+
+		return getpos();
+	}
+
+	/**
+	 * @date 2026-10-16 19:41:26
+	 *
+	 * Exact encoded length of value including end-of-sequence marker.
+	 *
+	 * @date 2026-10-17 02:09:41
+	 *
+	 * Counts the escapes with `LENGTHTAB`, 7 payload bits per lookup, nothing is encoded.
+	 * The marker completes the trailing run when it has the same polarity, else it is a full RUNN+1 bits.
+	 *
+	 * @param {number} num - signed value
+	 * @return {number} - length in bits
+	 */
+	static inline unsigned length(int64_t num) {
+		// number of bits before only sign bits remain
+		unsigned count = 63 - __builtin_clrsbll(num);
+		uint64_t data = num;
+		unsigned length = count;
+		unsigned row = 0; // fresh run
+
+		for (; count >= 7; count -= 7) {
+			const LENGTHBYTE &entry = lengthTab<RUNN>.tab[row][0x80 | (data & 0x7f)];
+			length += entry.escapes;
+			row = entry.next;
+			data >>= 7;
+		}
+
+		// remaining bits below a leading "1"
+		const LENGTHBYTE &entry = lengthTab<RUNN>.tab[row][1 << count | (data & ((1 << count) - 1))];
+		length += entry.escapes;
+		row = entry.next;
+
+		// end-of-sequence marker
+		unsigned runlength = row >> 1;
+		bool polarity = num < 0;
+		return length + ((row & 1) == polarity ? RUNN - runlength : RUNN) + 1;
+	}
+
+	/**
+	 * @date 2026-10-16 19:41:26
+	 *
+	 * Exact encoded length of array of values, to pre-size the output of `encodeBatch()`
+	 *
+	 * @param {int64_t[]} pNum - values
+	 * @param {number} n - number of values
+	 * @return {number} - length in bits
+	 */
+	static inline uint64_t lengthBatch(const int64_t *pNum, size_t n) {
+		uint64_t length = 0;
+
+		for (size_t i = 0; i < n; i++)
+			length += OUTBIT::length(pNum[i]);
+		return length;
+	}
+
+	/**
+	 * Encode signed value
+	 *
+	 * @param {string} pDest - bit-addressable memory (LSB emitted first).
+	 * @param {number} bitpos - bit-position
+	 * @param {number} num - signed value
+	 * @return {number} - length including terminator.
+	 */
+	inline void encodeSerial(unsigned pos, int64_t num) {
+		// start the engine
+		start(pos);
+
+		// as long as there are input bits
+		while (num != 0 && num != -1) {
+			// inject next LSB bit to output
+			emitbit(num & 1);
+
+			// bump binary decoding
+			num >>= 1; // NOTE: arithmetic shift leaves sign-bit untouched
+		}
+
+		// end-of-sequence polarity
+		num &= 1;
+
+		// Buildup leading bits until maximum run-length reached
+		emitEOSS(num);
+
+		// finalise end-of-sequence with same-polarity
+		emitraw(bit);
+
+		// write to memory
+		flush();
+	}
+
+};
+
+/*
+ * @date 2026-10-16 18:41:07
+ *
+ * Unsigned runlength-N encoding.
+ *
+ * Only runs of "0" are limited, "1" can be unlimited in length.
+ * After RUNN consecutive "0" the next raw bit is either
+ *   - an escape "1", which is not part of the payload and resets the run.
+ *   - the end-of-sequence marker "0". All following bits are "0".
+ * There is no sign to carry, values are one bit shorter on average and the end-of-sequence has a fixed polarity.
+ *
+ * Unlike `urun2.c` the ports do not rewind to shrink-wrap leading zeros, the escape is postponed until the next bit is known.
+ * This keeps the ports streaming, at the cost of non-minimal results when an operator produces leading zeros.
+ */
+
+/*
+ * @date 2026-10-16 18:41:07
+ *
+ * Lookup table to decode 8 raw bits per step, unsigned.
+ *
+ * The entries are generated by running the rules of `UINBIT::nextbit()` on every combination.
+ * The row is the number of consecutive "0" (0 to RUNN), `DECODEBYTE::next` is the row for the next lookup.
+ *
+ * @typedef {object} UDECODETAB
+ */
+template<unsigned RUNN>
+struct UDECODETAB {
+
+	DECODEBYTE tab[RUNN + 1][256];
+
+	constexpr UDECODETAB() : tab() {
+		for (unsigned row = 0; row < RUNN + 1; row++) {
+			for (unsigned raw = 0; raw < 256; raw++) {
+				unsigned runlength = row; // consecutive "0"
+				unsigned data = 0, count = 0, length = 0;
+				bool eos = false;
+
+				while (length < 8) {
+					unsigned t = (raw >> length++) & 1;
+
+					if (runlength == RUNN) {
+						// ARMED, next bit "0" = EOS, next bit "1" = escape
+						if (!t) {
+							eos = true;
+							break;
+						}
+						runlength = 0;
+						continue;
+					}
+
+					// payload bit
+					runlength = t ? 0 : runlength + 1;
+					data |= t << count++;
+				}
+
+				DECODEBYTE *pEntry = &tab[row][raw];
+				pEntry->data = data;
+				pEntry->count = count;
+				pEntry->length = length;
+				pEntry->next = (eos ? DECODEBYTE::EOS : 0) | runlength;
+			}
+		}
+	}
+};
+
+template<unsigned RUNN>
+constexpr UDECODETAB<RUNN> udecodeTab = UDECODETAB<RUNN>();
+
+/*
+ * @date 2026-10-16 18:41:07
+ *
+ * State context/namespace to read sequential memory, unsigned
+ *
+ * Same as `INBIT`, the shift register counts consecutive "0" only.
+ * After end-of-sequence `bit` stays "0".
+ *
+ * @typedef {object} UINBIT
+ */
+template<unsigned RUNN>
+struct UINBIT {
+
+	static_assert(RUNN >= 2 && RUNN <= 8, "runlength out of range");
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * State of the input port. Zero when stopped, otherwise a single bit.
+	 * The bit number indicates the number of consecutive "0" already read.
+	 */
+	unsigned state;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Value of decoded bit.
+	 */
+	bool bit;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Memory base address. Addressing is relative to bit 0
+	 */
+	unsigned char *const pBase;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Pointer to current byte,
+	 */
+	unsigned char *pMem;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Shift register containing bit to indicate active bit within the byte.
+	 */
+	unsigned char mask;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Constructor/Initialise
+	 */
+	inline UINBIT(unsigned char *pBase) : pBase(pBase) {
+		this->state = 0; // stop state
+		this->bit = 0;
+		this->pMem = NULL; // current memory location is undefined
+		this->mask = 0x01; // Set a single bit
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * reset state and set address of first bit of sequential memory
+	 */
+	inline void start(unsigned pos) {
+		this->pMem = this->pBase + (pos >> 3); // in which byte is active bit located
+		this->mask = 1 << (pos & 7); // set position of active bit;
+		this->state = 1; // start machine and indicate that zero bits have been processed (bit0==1)
+		this->bit = 0;
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Read and return next raw bit from memory
+	 */
+	inline unsigned nextraw(void) {
+		unsigned t = (*pMem & mask) ? 1 : 0;
+
+		// shift/rotate the bit in `mask` to mark next active bit
+		mask = mask << 1 | mask >> 7;
+
+		// When bit rotates, bump memory pointer
+		pMem += (mask & 1);
+
+		return t;
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Return current position of bit/sequential memory
+	 */
+	unsigned getpos(void) {
+		return (this->pMem - this->pBase) * 8 + __builtin_ctz(mask);
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Decode next bit from memory
+	 */
+	inline void nextbit(void) {
+		// leave `bit` ("0") untouched when in `stop` state
+		if (!state)
+			return;
+
+		// test for arming of end-of-sequence marker
+		if (state & (1 << RUNN)) {
+			/*
+			 * ARMED, next bit "1" = escape, next bit "0" = EOS
+			 */
+			state = nextraw();
+			if (!state)
+				return; // end-of-sequence. DO NOT read next bit
+		}
+
+		// read next bit from sequential memory, "1" resets the run
+		bit = nextraw();
+		state = bit ? 1 : state << 1;
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Decode unsigned value, bit-serial.
+	 *
+	 * @param {number} pos - bit-position
+	 * @return {uint64_t} - The decoded value. Bits beyond 64 are discarded.
+	 */
+	inline uint64_t decodeSerial(unsigned pos) {
+		uint64_t num = 0; // fixed-width number being decoded
+		unsigned numlen = 0; // length of fixed-width `num` in bits
+
+		// start engine
+		start(pos);
+
+		do {
+			nextbit();
+			if (numlen < 64)
+				num |= (uint64_t) bit << numlen;
+			numlen++;
+		} while (state);
+
+		return num;
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Table-driven decode, 8 raw bits per step.
+	 * Produces the same value and leaves the port in the same state as `decodeSerial()`.
+	 *
+	 * NOTE: reads one byte beyond the byte containing the end-of-sequence marker.
+	 *
+	 * @param {number} pos - bit-position
+	 * @return {uint64_t} - The decoded value. Bits beyond 64 are discarded.
+	 */
+	inline uint64_t decode(unsigned pos) {
+		uint64_t num = 0; // fixed-width number being decoded
+		unsigned numlen = 0; // length of fixed-width `num` in bits
+		unsigned row = 0; // decoder state as table row, same as `start()`
+
+		for (;;) {
+			// next 8 raw bits, starting at any bit position
+			const unsigned char *p = pBase + (pos >> 3);
+			unsigned raw = ((p[0] | p[1] << 8) >> (pos & 7)) & 0xff;
+
+			const DECODEBYTE &entry = udecodeTab<RUNN>.tab[row][raw];
+
+			// append payload
+			if (numlen < 64)
+				num |= (uint64_t) entry.data << numlen;
+			numlen += entry.count;
+
+			pos += entry.length;
+			row = entry.next;
+
+			if (row & DECODEBYTE::EOS)
+				break;
+		}
+
+		// update port to reflect end-of-sequence
+		this->pMem = this->pBase + (pos >> 3);
+		this->mask = 1 << (pos & 7);
+		this->state = 0;
+		this->bit = 0;
+
+		return num;
+	}
+
+	/**
+	 * @date 2026-10-16 18:58:44
+	 *
+	 * Skip value without decoding, 64 raw bits per step.
+	 * Leaves the port in the same state as `decode()`.
+	 *
+	 * The end-of-sequence marker is the first run of RUNN+1 "0" raw bits.
+	 *
+	 * NOTE: Reads 64-bit words, up to 9 bytes beyond the end-of-sequence marker.
+	 *
+	 * @param {number} pos - bit-position
+	 * @return {number} - position following end-of-sequence
+	 */
+	inline unsigned skip(unsigned pos) {
+		for (;;) {
+			uint64_t z = ~loadraw(pBase, pos);
+
+			// last bit of RUNN+1 "0"
+			uint64_t run = z;
+			for (unsigned k = 1; k <= RUNN; k++)
+				run &= z << k;
+
+			if (run) {
+				pos += __builtin_ctzll(run) + 1;
+				break;
+			}
+
+			pos += 64 - RUNN;
+		}
+
+		// update port to reflect end-of-sequence
+		this->pMem = this->pBase + (pos >> 3);
+		this->mask = 1 << (pos & 7);
+		this->state = 0;
+		this->bit = 0;
+
+		return pos;
+	}
+
+	/*
+	 * @date 2026-10-16 18:58:44
+	 *
+	 * Number of raw bits of the value at `pos`, including end-of-sequence marker
+	 */
+	inline unsigned encodedLength(unsigned pos) {
+		return skip(pos) - pos;
+	}
+
+};
+
+#if defined(__x86_64__)
+
+/*
+ * @date 2026-10-16 18:41:07
+ *
+ * Decode kernel for x86-64 with BMI2, unsigned.
+ *
+ * Same as `INPEXT`. The escape is a "1", which already breaks runs of "0", so a run is simply RUNN consecutive "0".
+ * The first window has a history of "1", which never forms a run.
+ *
+ * NOTE: Reads 64-bit words, up to 9 bytes beyond the end-of-sequence marker.
+ *
+ * @typedef {object} UINPEXT
+ */
+template<unsigned RUNN>
+struct UINPEXT {
+
+	// mask of history bits in the window
+	static constexpr uint64_t HISTORY = (1ULL << RUNN) - 1;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Memory base address. Addressing is relative to bit 0
+	 */
+	unsigned char *const pBase;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Position following the last decoded end-of-sequence marker
+	 */
+	unsigned pos;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Constructor/Initialise
+	 */
+	inline UINPEXT(unsigned char *pBase) : pBase(pBase) {
+		this->pos = 0;
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Return current position of bit/sequential memory
+	 */
+	unsigned getpos(void) {
+		return this->pos;
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Decode value starting at `pos`.
+	 *
+	 * @param {number} pos - bit-position
+	 * @return {uint64_t} - The decoded value. Bits beyond 64 are discarded.
+	 */
+	__attribute__((target("bmi2"))) uint64_t decode(unsigned pos) {
+		uint64_t num = 0; // fixed-width number being decoded
+		unsigned numlen = 0; // length of fixed-width `num` in bits
+		uint64_t history = HISTORY; // "1", no run
+
+		for (;;) {
+			// history in the lower RUNN bits, followed by raw bits
+			uint64_t x = loadraw(pBase, pos) << RUNN | history;
+
+			// bits following RUNN consecutive "0"
+			uint64_t run = ~x;
+			for (unsigned k = 1; k < RUNN; k++)
+				run &= ~x << k;
+			run <<= 1;
+
+			// only consider raw bits, not history
+			uint64_t escape = run & x & ~HISTORY;
+			uint64_t eos = run & ~x & ~HISTORY;
+
+			if (eos) {
+				// payload before end-of-sequence
+				unsigned z = __builtin_ctzll(eos);
+				uint64_t payload = ~escape & ((1ULL << z) - 1) & ~HISTORY;
+
+				if (numlen < 64)
+					num |= _pext_u64(x, payload) << numlen;
+
+				this->pos = pos + z - RUNN + 1;
+				return num;
+			}
+
+			// complete window is payload
+			uint64_t payload = ~escape & ~HISTORY;
+
+			if (numlen < 64)
+				num |= _pext_u64(x, payload) << numlen;
+			numlen += __builtin_popcountll(payload);
+
+			history = x >> (64 - RUNN);
+			pos += 64 - RUNN;
+		}
+	}
+};
+
+#endif
+
+/*
+ * @date 2026-10-16 18:41:07
+ *
+ * State context/namespace to write sequential memory, unsigned
+ *
+ * Same as `OUTBIT`, the shift register counts consecutive "0" only.
+ *
+ * @typedef {object} UOUTBIT
+ */
+template<unsigned RUNN>
+struct UOUTBIT {
+
+	static_assert(RUNN >= 2 && RUNN <= 8, "runlength out of range");
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * State of port as a shift register containing a single bit.
+	 * The bit number indicates the number of consecutive "0" already written.
+	 */
+	unsigned state;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Value of last encoded bit written
+	 */
+	bool bit;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Memory base address. Addressing is relative to bit 0
+	 */
+	unsigned char *const pBase;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Pointer to the first byte of `word`.
+	 */
+	unsigned char *pMem;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Write-combining register, see `OUTBIT::word`.
+	 */
+	uint64_t word;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Number of bits in `word`. Always less than 64.
+	 */
+	unsigned wordlen;
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Constructor/Initialise
+	 */
+	inline UOUTBIT(unsigned char *pBase) : pBase(pBase) {
+		state = 0; // stop state
+		bit = 0; // last decoded bits
+		pMem = NULL; // Memory location is undefined
+		word = 0; // nothing collected
+		wordlen = 0;
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * reset state and set address of first bit of sequential memory
+	 *
+	 * NOTE: Pending bits of a previous sequence are discarded, `flush()` it first.
+	 */
+	inline void start(unsigned pos) {
+		this->bit = 0;
+		this->pMem = pBase + (pos >> 3); // in which byte is first bit located
+		this->wordlen = pos & 7; // set position of first bit
+		this->word = *this->pMem & ((1 << this->wordlen) - 1); // preserve preceding bits of first byte
+		this->state = 1; // state is nothing previously emitted (bit0 set)
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Return current position of bit/sequential memory
+	 * This includes the bits that are not yet flushed to memory.
+	 */
+	unsigned getpos(void) {
+		return (this->pMem - this->pBase) * 8 + this->wordlen;
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Write collected bits to memory. Bits beyond the current position are preserved.
+	 */
+	inline void flush(void) {
+		uint64_t m = (1ULL << wordlen) - 1; // bits to be written
+
+		// merge with memory
+		uint64_t w;
+		memcpy(&w, pMem, sizeof w);
+		w = (w & ~m) | (word & m);
+		memcpy(pMem, &w, sizeof w);
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 */
+	inline void emitraw(bool b) {
+		// collect bit
+		word |= (uint64_t) b << wordlen;
+
+		// write when full
+		if (++wordlen == 64) {
+			memcpy(pMem, &word, sizeof word);
+			pMem += sizeof word;
+			word = 0;
+			wordlen = 0;
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Emit `n` (0-64) raw bits, LSB first.
+	 */
+	inline void emitword(uint64_t bits, unsigned n) {
+		if (n < 64)
+			bits &= (1ULL << n) - 1;
+
+		// collect bits
+		word |= bits << wordlen;
+
+		// write when full, keep what did not fit
+		if (wordlen + n >= 64) {
+			memcpy(pMem, &word, sizeof word);
+			pMem += sizeof word;
+			word = wordlen ? bits >> (64 - wordlen) : 0;
+			wordlen = wordlen + n - 64;
+		} else {
+			wordlen += n;
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 */
+	inline void emitbit(bool b) {
+		// if end-of-sequence is armed, emit mandatory escape
+		if (state & (1 << RUNN)) {
+			emitraw(1);
+			state = 1; // escape resets the run
+		}
+
+		// emit bit
+		emitraw(b);
+
+		// bump state, "1" resets the run
+		state = b ? 1 : state << 1;
+
+		// remember last emitted bit
+		bit = b;
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Emit an armed end-of-sequence marker
+	 *
+	 * Repeat emitting "0" until maximum run-length reached.
+	 * This can generate 0 to RUNN bits.
+	 * The caller finalises with a raw "0".
+	 */
+	inline void emitEOSS(void) {
+		while (!(state & (1 << RUNN)))
+			emitbit(0);
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Emit `count` (0-64) payload bits, LSB first. Same result as `count` times `emitbit()`.
+	 *
+	 * Same approach as `OUTBIT::emitdata()`.
+	 * A run of RUNN "0" ends where RUNN consecutive inverted data bits are set.
+	 */
+	inline void emitdata(uint64_t data, unsigned count) {
+		// data runs need RUNN bits of data, they can not end in the first RUNN-1 positions
+		static constexpr uint64_t DATARUN = (1ULL << (RUNN - 1)) - 1;
+
+		unsigned runlength = __builtin_ctz(state); // consecutive "0" already emitted
+
+		if (!count)
+			return;
+
+		// end positions of runs of RUNN "0" within the data
+		uint64_t valid = ~0ULL >> (64 - count);
+		uint64_t run = ~data & valid;
+		for (unsigned k = 1; k < RUNN; k++)
+			run &= ~data << k;
+
+		// if end-of-sequence is armed, emit mandatory escape
+		if (runlength == RUNN) {
+			emitword(1, 1);
+			runlength = 0;
+		}
+
+		for (;;) {
+			// data runs starting at the current position or later
+			uint64_t next = run & ~DATARUN;
+
+			// run continuing from previous bits
+			uint64_t ones = data | ~valid;
+			unsigned head = ones ? __builtin_ctzll(ones) : 64;
+			if (head >= RUNN - runlength)
+				next |= 1ULL << (RUNN - runlength - 1);
+
+			if (!next)
+				break;
+
+			// data bits up to including where runlength is reached
+			unsigned n = __builtin_ctzll(next) + 1;
+
+			if (n == count) {
+				// escape is postponed until more data arrives
+				emitword(data, n);
+				state = 1 << RUNN;
+				bit = 0;
+				return;
+			}
+
+			// emit segment including mandatory escape
+			emitword((data & ((1ULL << n) - 1)) | 1ULL << n, n + 1);
+			runlength = 0; // escape resets the run
+
+			// shift to next position
+			data >>= n;
+			valid >>= n;
+			run >>= n;
+			count -= n;
+		}
+
+		// remaining data needs no escapes, determine runlength of trailing "0"
+		uint64_t ones = data & valid;
+
+		if (ones)
+			runlength = count - 1 - (63 - __builtin_clzll(ones));
+		else
+			runlength += count;
+
+		emitword(data, count);
+		state = 1 << runlength;
+		bit = (data >> (count - 1)) & 1;
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Encode unsigned value, word-at-a-time.
+	 * Produces the same bits as `encodeSerial()`.
+	 *
+	 * @param {number} pos - bit-position
+	 * @param {number} num - unsigned value
+	 */
+	inline void encode(unsigned pos, uint64_t num) {
+		// start the engine
+		start(pos);
+
+		// inject data bits to output
+		emitdata(num, num ? 64 - __builtin_clzll(num) : 0);
+
+		// buildup "0" until maximum run-length reached and finalise with "0"
+		emitword(0, RUNN - __builtin_ctz(state) + 1);
+
+		// end-of-sequence leaves the marker armed
+		bit = 0;
+		state = 1 << RUNN;
+
+		// write to memory
+		flush();
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Encode unsigned value, bit-serial
+	 *
+	 * @param {number} pos - bit-position
+	 * @param {number} num - unsigned value
+	 */
+	inline void encodeSerial(unsigned pos, uint64_t num) {
+		// start the engine
+		start(pos);
+
+		// as long as there are input bits
+		while (num) {
+			emitbit(num & 1);
+			num >>= 1;
+		}
+
+		// Buildup leading bits until maximum run-length reached
+		emitEOSS();
+
+		// finalise end-of-sequence
+		emitraw(0);
+
+		// write to memory
+		flush();
+	}
+
+};
+
+/*
+ * @date 2026-10-16 18:03:37
+ *
+ * Kernels are interchangeable implementations of the encode/decode primitives.
+ * The bit-serial kernel runs everywhere and is the reference, the others are faster when the CPU supports them.
+ * They all produce identical results.
+ *
+ * Kernels are listed best first.
+ * On startup, the first kernel supported by the CPU is selected.
+ * The environment variable `ARMONIKA_KERNEL=<name>` or `kernelSelect()` force a kernel for benchmarking and testing.
+ *
+ * @date 2026-10-16 18:25:31
+ *
+ * The selection is shared by all runlengths, the entry points are in `KERNELOPS<RUNN>`.
+ *
+ * @typedef {object} KERNEL
+ */
+struct KERNEL {
+	const char *name; // name for `kernelSelect()` and `ARMONIKA_KERNEL`
+	bool (*supported)(void); // does CPU support the kernel
+};
+
+/*
+ * @date 2026-10-16 18:25:31
+ *
+ * Kernel entry points for runlength `RUNN`, in the same order as `kernels[]`
+ *
+ * @typedef {object} KERNELOPS
+ */
+template<unsigned RUNN>
+struct KERNELOPS {
+	int64_t (*decode)(unsigned char *pBase, unsigned pos, unsigned *pEnd); // decode value at `pos`, return position following end-of-sequence in `pEnd`
+	unsigned (*encode)(unsigned char *pBase, unsigned pos, int64_t num); // encode value at `pos`, return position following end-of-sequence
+	uint64_t (*udecode)(unsigned char *pBase, unsigned pos, unsigned *pEnd); // same as `decode`, unsigned
+	unsigned (*uencode)(unsigned char *pBase, unsigned pos, uint64_t num); // same as `encode`, unsigned
+	void (*decodeBatch)(unsigned char *pBase, const unsigned *pPos, size_t n, int64_t *pNum, unsigned *pEnd); // decode values at `pPos[]`, `pEnd` optional
+	void (*refill)(INCHUNK<RUNN> &chunk, const unsigned char *pBase); // `INCHUNK::refill()`
+
+	static const KERNELOPS list[];
+};
+
+/*
+ * @date 2026-10-16 20:02:39
+ *
+ * Batch decode by calling the single value decode of a kernel
+ */
+template<int64_t (*DECODE)(unsigned char *pBase, unsigned pos, unsigned *pEnd)>
+void eachDecode(unsigned char *pBase, const unsigned *pPos, size_t n, int64_t *pNum, unsigned *pEnd) {
+	for (size_t i = 0; i < n; i++) {
+		unsigned end;
+		pNum[i] = DECODE(pBase, pPos[i], &end);
+		if (pEnd)
+			pEnd[i] = end;
+	}
+}
+
+/*
+ * @date 2026-10-16 18:03:37
+ *
+ * Kernel: bit-serial, `INBIT::nextbit()` and `OUTBIT::emitbit()`
+ */
+bool serialSupported(void) {
+	return true;
+}
+
+template<unsigned RUNN>
+int64_t serialDecode(unsigned char *pBase, unsigned pos, unsigned *pEnd) {
+	INBIT<RUNN> ib(pBase);
+	int64_t num = ib.decodeSerial(pos);
+	*pEnd = ib.getpos();
+	return num;
+}
+
+template<unsigned RUNN>
+unsigned serialEncode(unsigned char *pBase, unsigned pos, int64_t num) {
+	OUTBIT<RUNN> ob(pBase);
+	ob.encodeSerial(pos, num);
+	return ob.getpos();
+}
+
+template<unsigned RUNN>
+uint64_t serialUDecode(unsigned char *pBase, unsigned pos, unsigned *pEnd) {
+	UINBIT<RUNN> ib(pBase);
+	uint64_t num = ib.decodeSerial(pos);
+	*pEnd = ib.getpos();
+	return num;
+}
+
+template<unsigned RUNN>
+unsigned serialUEncode(unsigned char *pBase, unsigned pos, uint64_t num) {
+	UOUTBIT<RUNN> ob(pBase);
+	ob.encodeSerial(pos, num);
+	return ob.getpos();
+}
+
+/*
+ * @date 2026-10-16 18:03:37
+ *
+ * Kernel: byte-at-a-time decode, word-at-a-time encode. Portable.
+ */
+bool tableSupported(void) {
+	return true;
+}
+
+template<unsigned RUNN>
+int64_t tableDecode(unsigned char *pBase, unsigned pos, unsigned *pEnd) {
+	INBIT<RUNN> ib(pBase);
+	int64_t num = ib.decode(pos);
+	*pEnd = ib.getpos();
+	return num;
+}
+
+template<unsigned RUNN>
+unsigned wordEncode(unsigned char *pBase, unsigned pos, int64_t num) {
+	OUTBIT<RUNN> ob(pBase);
+	ob.encode(pos, num);
+	return ob.getpos();
+}
+
+template<unsigned RUNN>
+uint64_t tableUDecode(unsigned char *pBase, unsigned pos, unsigned *pEnd) {
+	UINBIT<RUNN> ib(pBase);
+	uint64_t num = ib.decode(pos);
+	*pEnd = ib.getpos();
+	return num;
+}
+
+template<unsigned RUNN>
+unsigned wordUEncode(unsigned char *pBase, unsigned pos, uint64_t num) {
+	UOUTBIT<RUNN> ob(pBase);
+	ob.encode(pos, num);
+	return ob.getpos();
+}
+
+template<unsigned RUNN>
+void tableRefill(INCHUNK<RUNN> &chunk, const unsigned char *pBase) {
+	chunk.refill(pBase);
+}
+
+#if defined(__x86_64__)
+
+/*
+ * @date 2026-10-16 18:03:37
+ *
+ * Kernel: `pext` decode, word-at-a-time encode. x86-64 with BMI2.
+ */
+bool bmi2Supported(void) {
+	__builtin_cpu_init(); // might be called before constructors of libgcc
+	return __builtin_cpu_supports("bmi2");
+}
+
+template<unsigned RUNN>
+int64_t bmi2Decode(unsigned char *pBase, unsigned pos, unsigned *pEnd) {
+	INPEXT<RUNN> px(pBase);
+	int64_t num = px.decode(pos);
+	*pEnd = px.getpos();
+	return num;
+}
+
+template<unsigned RUNN>
+uint64_t bmi2UDecode(unsigned char *pBase, unsigned pos, unsigned *pEnd) {
+	UINPEXT<RUNN> px(pBase);
+	uint64_t num = px.decode(pos);
+	*pEnd = px.getpos();
+	return num;
+}
+
+template<unsigned RUNN>
+void bmi2Refill(INCHUNK<RUNN> &chunk, const unsigned char *pBase) {
+	chunk.refillPext(pBase);
+}
+
+/*
+ * @date 2026-10-16 20:02:39
+ *
+ * Kernel: `bmi2` with AVX2 gather batch decode. x86-64 with BMI2 and AVX2.
+ * Ranked after `bmi2`: gather latency makes per-value `pext` decoding faster on current cores.
+ */
+bool avx2Supported(void) {
+	return bmi2Supported() && __builtin_cpu_supports("avx2");
+}
+
+template<unsigned RUNN>
+void gatherDecodeBatch(unsigned char *pBase, const unsigned *pPos, size_t n, int64_t *pNum, unsigned *pEnd) {
+	INGATHER<RUNN> gx(pBase);
+	gx.decode(pPos, n, pNum, pEnd);
+}
+
+#endif
+
+const KERNEL kernels[] = {
+#if defined(__x86_64__)
+	{"bmi2",   bmi2Supported},
+	{"avx2",   avx2Supported},
+#endif
+	{"table",  tableSupported},
+	{"serial", serialSupported},
+};
+
+template<unsigned RUNN>
+const KERNELOPS<RUNN> KERNELOPS<RUNN>::list[] = {
+#if defined(__x86_64__)
+	{bmi2Decode<RUNN>,   wordEncode<RUNN>,   bmi2UDecode<RUNN>,   wordUEncode<RUNN>,   eachDecode<bmi2Decode<RUNN> >,   bmi2Refill<RUNN>},
+	{bmi2Decode<RUNN>,   wordEncode<RUNN>,   bmi2UDecode<RUNN>,   wordUEncode<RUNN>,   gatherDecodeBatch<RUNN>,         bmi2Refill<RUNN>},
+#endif
+	{tableDecode<RUNN>,  wordEncode<RUNN>,   tableUDecode<RUNN>,  wordUEncode<RUNN>,   eachDecode<tableDecode<RUNN> >,  tableRefill<RUNN>},
+	{serialDecode<RUNN>, serialEncode<RUNN>, serialUDecode<RUNN>, serialUEncode<RUNN>, eachDecode<serialDecode<RUNN> >, tableRefill<RUNN>},
+};
+
+enum {
+	numKernels = sizeof kernels / sizeof kernels[0],
+};
+
+/*
+ * @date 2026-10-16 18:03:37
+ *
+ * Select kernel by name, or the best supported when `NULL`.
+ *
+ * @param {string} pName - name of kernel
+ * @return {number} - index of selected kernel, or `numKernels` when unknown or not supported by CPU
+ */
+unsigned kernelFind(const char *pName) {
+	for (unsigned i = 0; i < numKernels; i++) {
+		if (pName && strcmp(pName, kernels[i].name) != 0)
+			continue;
+		if (kernels[i].supported())
+			return i;
+	}
+	return numKernels;
+}
+
+/*
+ * @date 2026-10-16 18:03:37
+ *
+ * Startup selection, honouring `ARMONIKA_KERNEL`
+ */
+unsigned kernelStartup(void) {
+	const char *pName = getenv("ARMONIKA_KERNEL");
+	unsigned ix = kernelFind(pName);
+
+	if (ix == numKernels) {
+		fprintf(stderr, "ARMONIKA_KERNEL=%s unknown or not supported, using best available\n", pName);
+		ix = kernelFind(NULL);
+	}
+	return ix;
+}
+
+// active kernel
+unsigned kernelIndex = kernelStartup();
+
+/*
+ * @date 2026-10-16 18:03:37
+ *
+ * Force kernel for benchmarking and testing.
+ *
+ * @param {string} pName - name of kernel
+ * @return {boolean} - `false` when unknown or not supported by CPU. The active kernel is left unchanged.
+ */
+bool kernelSelect(const char *pName) {
+	unsigned ix = kernelFind(pName);
+
+	if (ix == numKernels)
+		return false;
+	kernelIndex = ix;
+	return true;
+}
+
+/*
+ * @date 2026-10-16 18:25:31
+ *
+ * Entry points of active kernel for runlength `RUNN`
+ */
+template<unsigned RUNN>
+inline const KERNELOPS<RUNN> &kernel(void) {
+	return KERNELOPS<RUNN>::list[kernelIndex];
+}
+
+/*
+ * @date 2026-10-16 19:20:13
+ *
+ * Parallel number-boundary scanner for concatenated streams.
+ *
+ * A raw run of more than RUNN identical bits can only occur at an end-of-sequence marker.
+ * The run starts with a polarity switch (or the start of the stream), which is always the first bit of a decoder run.
+ * Within a run starting at `s` and ending before `e`, markers are at `s + j*(RUNN+1) - 1`.
+ * Zero values of the same polarity can be back-to-back, a long run can contain multiple markers.
+ *
+ * This makes boundaries detectable in any chunk of the stream independently.
+ * Each chunk owns the runs that start inside it, even if they extend into the next chunk.
+ * Candidates (RUNN+1 identical bits) are located 256 raw bits at a time with AVX2, or 64 raw bits at a time otherwise.
+ * Chunks are scanned by concurrent threads, the per-chunk results are concatenated into a single table.
+ *
+ * NOTE: Reads 64-bit words, up to 48 bytes beyond the end of the stream.
+ *
+ * @typedef {object} BOUNDARY
+ */
+template<unsigned RUNN>
+struct BOUNDARY {
+
+	static_assert(RUNN >= 2 && RUNN <= 8, "runlength out of range");
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Work unit of a thread
+	 */
+	struct CHUNK {
+		BOUNDARY *pScanner;
+		uint64_t c0, c1; // runs starting in [c0,c1) belong to this chunk
+		uint64_t *pEnds; // positions following end-of-sequence markers
+		uint64_t count; // number of entries in `pEnds`
+		uint64_t capacity; // allocated entries of `pEnds`
+	};
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Memory base address. The stream starts at bit 0
+	 */
+	const unsigned char *const pBase;
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Length of the stream in bits
+	 */
+	const uint64_t nbits;
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Use AVX2 candidate search. Defaults to CPU support
+	 */
+	bool simd;
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Constructor/Initialise
+	 */
+	inline BOUNDARY(const unsigned char *pBase, uint64_t nbits) : pBase(pBase), nbits(nbits) {
+#if defined(__x86_64__)
+		__builtin_cpu_init();
+		this->simd = __builtin_cpu_supports("avx2");
+#else
+		this->simd = false;
+#endif
+	}
+
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Run masks of the 64 raw bits at `pos`:
+	 *   - `change` marks bits different from their predecessor, the start of runs.
+	 *   - `full` marks the last bit of RUNN+1 identical bits.
+	 */
+	inline void masks(uint64_t pos, uint64_t *pChange, uint64_t *pFull) {
+		uint64_t x = loadraw(pBase, pos);
+		uint64_t prev = pos >= 64 ? loadraw(pBase, pos - 64) : 0;
+
+		uint64_t neq = 0;
+		for (unsigned k = 1; k <= RUNN; k++)
+			neq |= x ^ (x << k | prev >> (64 - k));
+
+		*pChange = x ^ (x << 1 | prev >> 63);
+		*pFull = ~neq;
+
+		// bits preceding the stream do not count, first bit starts a run
+		if (pos == 0) {
+			*pChange |= 1;
+			*pFull &= ~((1ULL << RUNN) - 1);
+		}
+	}
+
+#if defined(__x86_64__)
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Same as `masks()` for 256 raw bits starting at byte `p`, `p-8` must be readable.
+	 * Each 64-bit lane uses the lane below it as history.
+	 */
+	__attribute__((target("avx2"))) static void masks256(const unsigned char *p, uint64_t *pChange, uint64_t *pFull) {
+		__m256i x = _mm256_loadu_si256((const __m256i *) p);
+		__m256i prev = _mm256_loadu_si256((const __m256i *) (p - 8));
+
+		__m256i neq = _mm256_setzero_si256();
+		for (unsigned k = 1; k <= RUNN; k++)
+			neq = _mm256_or_si256(neq, _mm256_xor_si256(x, _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(prev, 64 - k))));
+
+		__m256i change = _mm256_xor_si256(x, _mm256_or_si256(_mm256_slli_epi64(x, 1), _mm256_srli_epi64(prev, 63)));
+
+		_mm256_storeu_si256((__m256i *) pChange, change);
+		_mm256_storeu_si256((__m256i *) pFull, _mm256_xor_si256(neq, _mm256_set1_epi64x(-1)));
+	}
+
+#endif
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Add the markers of the word at `pos` to chunk results
+	 */
+	static void append(CHUNK &chunk, uint64_t pos, uint64_t eos) {
+		// room for a complete word
+		if (chunk.capacity - chunk.count < 64) {
+			chunk.capacity = chunk.capacity ? chunk.capacity * 2 : 1024;
+			chunk.pEnds = (uint64_t *) realloc(chunk.pEnds, chunk.capacity * sizeof *chunk.pEnds);
+			if (!chunk.pEnds) {
+				fprintf(stderr, "out of memory\n");
+				exit(1);
+			}
+		}
+
+		uint64_t *pEnds = chunk.pEnds + chunk.count;
+		chunk.count += __builtin_popcountll(eos);
+
+		while (eos) {
+			*pEnds++ = pos + __builtin_ctzll(eos) + 1;
+			eos &= eos - 1;
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Locate all end-of-sequence markers of runs starting in chunk, 256 raw bits per step.
+	 *
+	 * The first marker of a run is a `full` bit RUNN positions after a start owned by the chunk.
+	 * Further markers follow every RUNN+1 bits as long as the run continues.
+	 * Runs starting before the chunk never get a first marker, the scan continues past the chunk until all its runs ended.
+	 */
+	void scan(CHUNK &chunk) {
+		uint64_t prevChange = 0; // `change` of preceding word
+		uint64_t prevStarts = 0; // owned run starts of preceding word, none before chunk
+		uint64_t prevEos = 0; // markers of preceding word
+
+		if (chunk.c0 >= 64) {
+			uint64_t full;
+			masks(chunk.c0 - 64, &prevChange, &full);
+		}
+
+		for (uint64_t block = chunk.c0;; block += 256) {
+			uint64_t blockChange[4], blockFull[4];
+
+#if defined(__x86_64__)
+			if (simd && block >= 64)
+				masks256(pBase + block / 8, blockChange, blockFull);
+			else
+#endif
+				for (unsigned j = 0; j < 4; j++)
+					masks(block + j * 64, &blockChange[j], &blockFull[j]);
+
+			for (unsigned j = 0; j < 4; j++) {
+				uint64_t pos = block + j * 64;
+				uint64_t change = blockChange[j];
+				uint64_t full = blockFull[j];
+
+				// end of stream, or past the chunk and all runs ended
+				if (pos >= nbits || (pos >= chunk.c1 + 64 && !prevEos))
+					return;
+
+				// only runs starting in chunk
+				uint64_t starts = pos < chunk.c1 ? change : 0;
+
+				// run continues from RUNN+1 positions back
+				uint64_t cont = full & ~(change << RUNN | prevChange >> (64 - RUNN));
+
+				// first marker of run, then chain of markers
+				uint64_t eos = full & (starts << RUNN | prevStarts >> (64 - RUNN));
+				eos |= cont & prevEos >> (63 - RUNN);
+				for (;;) {
+					uint64_t chain = eos | (cont & eos << (RUNN + 1));
+					if (chain == eos)
+						break;
+					eos = chain;
+				}
+
+				// not beyond stream
+				if (nbits - pos < 64)
+					eos &= (1ULL << (nbits - pos)) - 1;
+
+				prevChange = change;
+				prevStarts = starts;
+				prevEos = eos;
+
+				if (eos)
+					append(chunk, pos, eos);
+			}
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Thread entrypoint
+	 */
+	static void *worker(void *arg) {
+		CHUNK *pChunk = (CHUNK *) arg;
+		pChunk->pScanner->scan(*pChunk);
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-16 19:20:13
+	 *
+	 * Scan the stream using concurrent threads.
+	 * Value `i` occupies the raw bits from `pEnds[i-1]` (or 0) up to `pEnds[i]`.
+	 *
+	 * @param {number} numThreads - number of threads, each scanning an equal sized chunk
+	 * @param {number} pCount - number of values found
+	 * @return {uint64_t[]} - positions following each end-of-sequence marker, to be `free()`d by caller
+	 */
+	uint64_t *scanAll(unsigned numThreads, uint64_t *pCount) {
+		CHUNK *pChunks = (CHUNK *) calloc(numThreads, sizeof *pChunks);
+		pthread_t *pThreads = (pthread_t *) calloc(numThreads, sizeof *pThreads);
+		if (!pChunks || !pThreads) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+
+		// chunks are a multiple of 256 bits
+		uint64_t chunkSize = ((nbits + numThreads - 1) / numThreads + 255) & ~255ULL;
+
+		for (unsigned i = 0; i < numThreads; i++) {
+			pChunks[i].pScanner = this;
+			pChunks[i].c0 = i * chunkSize < nbits ? i * chunkSize : nbits;
+			pChunks[i].c1 = (i + 1) * chunkSize < nbits ? (i + 1) * chunkSize : nbits;
+		}
+
+		// first chunk on calling thread
+		for (unsigned i = 1; i < numThreads; i++) {
+			if (pthread_create(&pThreads[i], NULL, worker, &pChunks[i]) != 0) {
+				fprintf(stderr, "pthread_create() failed\n");
+				exit(1);
+			}
+		}
+		scan(pChunks[0]);
+		for (unsigned i = 1; i < numThreads; i++)
+			pthread_join(pThreads[i], NULL);
+
+		// concatenate
+		uint64_t count = 0;
+		for (unsigned i = 0; i < numThreads; i++)
+			count += pChunks[i].count;
+
+		uint64_t *pEnds = (uint64_t *) malloc((count ? count : 1) * sizeof *pEnds);
+		if (!pEnds) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+
+		count = 0;
+		for (unsigned i = 0; i < numThreads; i++) {
+			memcpy(pEnds + count, pChunks[i].pEnds, pChunks[i].count * sizeof *pEnds);
+			count += pChunks[i].count;
+			free(pChunks[i].pEnds);
+		}
+
+		free(pThreads);
+		free(pChunks);
+
+		*pCount = count;
+		return pEnds;
+	}
+};
+
+// timer tick
+int tick = 0;
+
+/*
+ * @date 2026-10-16 21:30:17
+ *
+ * Opcodes of the generic operators of `ALU::shiftOP()` and `SLICEALU`
+ */
+enum {
+	OP_ADD, OP_SUB, OP_AND, OP_XOR, OP_OR,
+};
+
+/*
+ * @date 2026-10-16 22:13:40
+ *
+ * Multiplication of long unsigned numbers stored as arrays of 64-bit limbs, least significant first.
+ *
+ * Depending on the number of limbs:
+ *   - schoolbook, quadratic.
+ *   - Karatsuba, three half-size products, `O(n^1.58)`.
+ *   - Toom-3, five third-size products evaluated at 0, 1, -1, 2 and infinity, `O(n^1.46)`.
+ * Intermediates that can become negative are kept as sign and magnitude, or two's complement of fixed width.
+ *
+ * @typedef {object} BIGMUL
+ */
+struct BIGMUL {
+
+	enum {
+		/*
+		 * @date 2026-10-16 22:13:40
+		 *
+		 * Default thresholds in limbs, determined by timing one level of each method on operands of 4 to 2048 limbs.
+		 * Karatsuba is ahead of schoolbook from about 20 limbs, Toom-3 of Karatsuba from about 320.
+		 *
+		 * @date 2026-10-17 01:47:19
+		 *
+		 * `srunbench -t` repeats the sweep. It places Toom-3 ahead from 181-256 limbs, but only by a few percent,
+		 * and a complete `mulN()` with a lower `toom3Limbs` is not faster up to 4000 limbs.
+		 */
+		KARATSUBA = 20,
+		TOOM3 = 320,
+	};
+
+	unsigned karatsubaLimbs; // number of limbs from which Karatsuba is used
+	unsigned toom3Limbs;     // number of limbs from which Toom-3 is used
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Constructor/Initialise
+	 */
+	inline BIGMUL() : karatsubaLimbs(KARATSUBA), toom3Limbs(TOOM3) {
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..n) = pA[0..n) + pB[0..n)`, return carry
+	 */
+	static inline uint64_t add(uint64_t *pR, const uint64_t *pA, const uint64_t *pB, unsigned n) {
+		uint64_t carry = 0;
+		for (unsigned i = 0; i < n; i++) {
+			uint64_t sum;
+			carry = __builtin_add_overflow(pA[i], pB[i], &sum) | __builtin_add_overflow(sum, carry, &sum);
+			pR[i] = sum;
+		}
+		return carry;
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..n) = pA[0..n) - pB[0..n)`, return borrow
+	 */
+	static inline uint64_t sub(uint64_t *pR, const uint64_t *pA, const uint64_t *pB, unsigned n) {
+		uint64_t borrow = 0;
+		for (unsigned i = 0; i < n; i++) {
+			uint64_t diff;
+			borrow = __builtin_sub_overflow(pA[i], pB[i], &diff) | __builtin_sub_overflow(diff, borrow, &diff);
+			pR[i] = diff;
+		}
+		return borrow;
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..nR) += pA[0..nA)`, `nA <= nR`, return carry
+	 */
+	static inline uint64_t addto(uint64_t *pR, unsigned nR, const uint64_t *pA, unsigned nA) {
+		uint64_t carry = add(pR, pR, pA, nA);
+		for (unsigned i = nA; carry && i < nR; i++)
+			carry = ++pR[i] == 0;
+		return carry;
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..nR) -= pA[0..nA)`, `nA <= nR`, return borrow
+	 */
+	static inline uint64_t subfrom(uint64_t *pR, unsigned nR, const uint64_t *pA, unsigned nA) {
+		uint64_t borrow = sub(pR, pR, pA, nA);
+		for (unsigned i = nA; borrow && i < nR; i++)
+			borrow = pR[i]-- == 0;
+		return borrow;
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Two's complement negate `pR[0..n)`
+	 */
+	static inline void neg(uint64_t *pR, unsigned n) {
+		uint64_t borrow = 0;
+		for (unsigned i = 0; i < n; i++) {
+			uint64_t x = pR[i];
+			pR[i] = -x - borrow;
+			borrow |= x != 0;
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..n) += pA[0..n) * m`, return carry limb
+	 */
+	static inline uint64_t muladd1(uint64_t *pR, const uint64_t *pA, unsigned n, uint64_t m) {
+		uint64_t carry = 0;
+		for (unsigned i = 0; i < n; i++) {
+			unsigned __int128 t = (unsigned __int128) pA[i] * m + pR[i] + carry;
+			pR[i] = (uint64_t) t;
+			carry = t >> 64;
+		}
+		return carry;
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..n) = pR[0..n) / 3` in two's complement, exact.
+	 * Each limb is multiplied with the inverse of 3 modulo 2^64, the high part of `q*3` is borrowed from the next.
+	 */
+	static inline void divexact3(uint64_t *pR, unsigned n) {
+		static constexpr uint64_t INV3 = 0xaaaaaaaaaaaaaaabULL;
+		uint64_t borrow = 0;
+		for (unsigned i = 0; i < n; i++) {
+			uint64_t x = pR[i];
+			uint64_t q = (x - borrow) * INV3;
+			pR[i] = q;
+			borrow = (x < borrow) + (uint64_t) (((unsigned __int128) q * 3) >> 64);
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..n) >>= 1` in two's complement
+	 */
+	static inline void sar1(uint64_t *pR, unsigned n) {
+		for (unsigned i = 0; i + 1 < n; i++)
+			pR[i] = pR[i] >> 1 | pR[i + 1] << 63;
+		pR[n - 1] = (int64_t) pR[n - 1] >> 1;
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..nX) = |pX[0..nX) - pY[0..nY)|`, `nY <= nX`, return `true` when negative
+	 */
+	static inline bool absdiff(uint64_t *pR, const uint64_t *pX, unsigned nX, const uint64_t *pY, unsigned nY) {
+		// compare, the extra limbs of `pX` first
+		int cmp = 0;
+		for (unsigned i = nX; i > nY && !cmp; i--)
+			cmp = pX[i - 1] != 0;
+		for (unsigned i = nY; i > 0 && !cmp; i--)
+			cmp = pX[i - 1] > pY[i - 1] ? 1 : pX[i - 1] < pY[i - 1] ? -1 : 0;
+
+		if (cmp >= 0) {
+			memcpy(pR, pX, nX * sizeof *pR);
+			subfrom(pR, nX, pY, nY);
+			return false;
+		} else {
+			// the extra limbs of `pX` are zero
+			sub(pR, pY, pX, nY);
+			memset(pR + nY, 0, (nX - nY) * sizeof *pR);
+			return true;
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Schoolbook, `pR[0..nA+nB) = pA[0..nA) * pB[0..nB)`
+	 */
+	static inline void schoolbook(uint64_t *pR, const uint64_t *pA, unsigned nA, const uint64_t *pB, unsigned nB) {
+		memset(pR, 0, nA * sizeof *pR);
+		for (unsigned j = 0; j < nB; j++)
+			pR[nA + j] = muladd1(pR + j, pA, nA, pB[j]);
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Karatsuba, `pR[0..2n) = pA[0..n) * pB[0..n)`
+	 *
+	 * With `a = a1*X + a0` and `b = b1*X + b0`:
+	 *   `a*b = a1*b1*X^2 + (a0*b0 + a1*b1 - (a1-a0)*(b1-b0))*X + a0*b0`
+	 * The differences are kept as sign and magnitude.
+	 */
+	void karatsuba(uint64_t *pR, const uint64_t *pA, const uint64_t *pB, unsigned n) {
+		unsigned h = n / 2; // limbs of the lower halves
+		unsigned m = n - h; // limbs of the upper halves, `h` or `h+1`
+
+		uint64_t *pScratch = (uint64_t *) malloc((6 * m + 1) * sizeof *pScratch);
+		if (!pScratch) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		uint64_t *pDA = pScratch, *pDB = pDA + m, *pProd = pDB + m, *pMid = pProd + 2 * m;
+
+		bool negative = absdiff(pDA, pA + h, m, pA, h) ^ absdiff(pDB, pB + h, m, pB, h);
+
+		mulN(pR, pA, pB, h);
+		mulN(pR + 2 * h, pA + h, pB + h, m);
+		mulN(pProd, pDA, pDB, m);
+
+		// middle term, never negative
+		memcpy(pMid, pR + 2 * h, 2 * m * sizeof *pMid);
+		pMid[2 * m] = 0;
+		addto(pMid, 2 * m + 1, pR, 2 * h);
+		if (negative)
+			addto(pMid, 2 * m + 1, pProd, 2 * m);
+		else
+			subfrom(pMid, 2 * m + 1, pProd, 2 * m);
+
+		addto(pR + h, 2 * n - h, pMid, 2 * m + 1 < 2 * n - h ? 2 * m + 1 : 2 * n - h);
+
+		free(pScratch);
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Toom-3, `pR[0..2n) = pA[0..n) * pB[0..n)`
+	 *
+	 * With `a = a2*X^2 + a1*X + a0`, the product `c(X) = c4*X^4 + ... + c0` is evaluated at 0, 1, -1, 2 and infinity:
+	 *   `w0 = c0`, `w1 = c0+c1+c2+c3+c4`, `wm1 = c0-c1+c2-c3+c4`, `w2 = c0+2*c1+4*c2+8*c3+16*c4`, `winf = c4`
+	 * and interpolated:
+	 *   `A = (w2-wm1)/3 = c1+c2+3*c3+5*c4`, `B = (w1-wm1)/2 = c1+c3`, `C = wm1-w0 = c2+c4-c1-c3`
+	 *   `c2 = B+C-c4`, `c3 = (A-B-c2-5*c4)/2`, `c1 = B-c3`
+	 * Evaluations are `k+1` limbs, interpolation is in two's complement of `2k+2` limbs.
+	 */
+	void toom3(uint64_t *pR, const uint64_t *pA, const uint64_t *pB, unsigned n) {
+		unsigned k = (n + 2) / 3; // limbs of the lower parts
+		unsigned l = n - 2 * k; // limbs of the top part
+		unsigned e = k + 1; // limbs of evaluations
+		unsigned w = 2 * e; // limbs of interpolation
+
+		uint64_t *pScratch = (uint64_t *) malloc((6 * e + 5 * w) * sizeof *pScratch);
+		if (!pScratch) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		uint64_t *pEval = pScratch; // `a` and `b` at 1, -1 and 2
+		uint64_t *pW1 = pEval + 6 * e, *pWM1 = pW1 + w, *pW2 = pWM1 + w, *pT = pW2 + w, *pU = pT + w;
+
+		bool negative = false;
+		for (unsigned j = 0; j < 2; j++) {
+			const uint64_t *pX = j ? pB : pA;
+			uint64_t *pE1 = pEval + j * e, *pEM1 = pE1 + 2 * e, *pE2 = pEM1 + 2 * e;
+
+			// a0+a2, then at 1 and -1
+			memcpy(pT, pX, k * sizeof *pT);
+			pT[k] = 0;
+			addto(pT, e, pX + 2 * k, l);
+			memcpy(pE1, pT, e * sizeof *pE1);
+			addto(pE1, e, pX + k, k);
+			negative ^= absdiff(pEM1, pT, e, pX + k, k);
+
+			// at 2: (a2*2 + a1)*2 + a0
+			memset(pE2, 0, e * sizeof *pE2);
+			memcpy(pE2, pX + 2 * k, l * sizeof *pE2);
+			addto(pE2, e, pE2, e);
+			addto(pE2, e, pX + k, k);
+			addto(pE2, e, pE2, e);
+			addto(pE2, e, pX, k);
+		}
+
+		mulN(pR, pA, pB, k);
+		mulN(pR + 4 * k, pA + 2 * k, pB + 2 * k, l);
+		mulN(pW1, pEval, pEval + e, e);
+		mulN(pWM1, pEval + 2 * e, pEval + 3 * e, e);
+		mulN(pW2, pEval + 4 * e, pEval + 5 * e, e);
+		if (negative)
+			neg(pWM1, w);
+
+		const uint64_t *pW0 = pR, *pWinf = pR + 4 * k;
+
+		// A in `pW2`, B in `pW1`, C in `pWM1`
+		sub(pW2, pW2, pWM1, w);
+		divexact3(pW2, w);
+		sub(pW1, pW1, pWM1, w);
+		sar1(pW1, w);
+		subfrom(pWM1, w, pW0, 2 * k);
+
+		// c2 in `pWM1`
+		addto(pWM1, w, pW1, w);
+		subfrom(pWM1, w, pWinf, 2 * l);
+
+		// c3 in `pW2`
+		sub(pW2, pW2, pW1, w);
+		sub(pW2, pW2, pWM1, w);
+		memset(pU, 0, w * sizeof *pU);
+		pU[2 * l] = muladd1(pU, pWinf, 2 * l, 5);
+		sub(pW2, pW2, pU, w);
+		sar1(pW2, w);
+
+		// c1 in `pW1`
+		sub(pW1, pW1, pW2, w);
+
+		// recompose, `c0` and `c4` are already in place
+		memset(pR + 2 * k, 0, 2 * k * sizeof *pR);
+		for (unsigned j = 1; j < 4; j++) {
+			const uint64_t *pC = j == 1 ? pW1 : j == 2 ? pWM1 : pW2;
+			unsigned room = 2 * n - j * k;
+			addto(pR + j * k, room, pC, w < room ? w : room);
+		}
+
+		free(pScratch);
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..2n) = pA[0..n) * pB[0..n)`, method selected by size
+	 */
+	void mulN(uint64_t *pR, const uint64_t *pA, const uint64_t *pB, unsigned n) {
+		if (n < karatsubaLimbs || n < 2)
+			schoolbook(pR, pA, n, pB, n);
+		else if (n < toom3Limbs || n < 7)
+			karatsuba(pR, pA, pB, n);
+		else
+			toom3(pR, pA, pB, n);
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * `pR[0..nA+nB) = pA[0..nA) * pB[0..nB)`
+	 *
+	 * Unbalanced operands are split into blocks the size of the shorter one.
+	 *
+	 * NOTE: `pR` should not overlap with the operands.
+	 */
+	void mul(uint64_t *pR, const uint64_t *pA, unsigned nA, const uint64_t *pB, unsigned nB) {
+		if (nA < nB) {
+			const uint64_t *pSwap = pA;
+			pA = pB;
+			pB = pSwap;
+			unsigned nSwap = nA;
+			nA = nB;
+			nB = nSwap;
+		}
+
+		if (nB < karatsubaLimbs) {
+			schoolbook(pR, pA, nA, pB, nB);
+			return;
+		}
+		if (nA == nB) {
+			mulN(pR, pA, pB, nA);
+			return;
+		}
+
+		uint64_t *pT = (uint64_t *) malloc(2 * nB * sizeof *pT);
+		if (!pT) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+
+		memset(pR, 0, (nA + nB) * sizeof *pR);
+		for (unsigned i = 0; i < nA; i += nB) {
+			unsigned len = nA - i < nB ? nA - i : nB;
+
+			mul(pT, pA + i, len, pB, nB);
+			addto(pR + i, nA + nB - i, pT, len + nB);
+		}
+
+		free(pT);
+	}
+};
+
+/*
+ * @date 2026-10-16 22:57:24
+ *
+ * Division of long unsigned numbers stored as arrays of 64-bit limbs, least significant first.
+ *
+ *   - restoring, one quotient bit per step, the divisor is subtracted when it fits the partial remainder.
+ *   - Knuth algorithm D, one quotient limb per step, estimated from the top two limbs and corrected at most twice.
+ *
+ * @typedef {object} BIGDIV
+ */
+struct BIGDIV {
+
+	/*
+	 * @date 2026-10-16 22:57:24
+	 *
+	 * Restoring division, `pQ[0..m) = pU[0..m) / pV[0..n)`, remainder in `pU[0..n)`, `pU[n..m)` cleared.
+	 *
+	 * @param pQ - quotient, `m` limbs
+	 * @param pU - dividend, replaced by remainder
+	 * @param pV - divisor, not zero
+	 * @param pR - work memory, `n+1` limbs
+	 */
+	static void restoring(uint64_t *pQ, uint64_t *pU, unsigned m, const uint64_t *pV, unsigned n, uint64_t *pR) {
+		memset(pQ, 0, m * sizeof *pQ);
+		memset(pR, 0, (n + 1) * sizeof *pR);
+
+		for (unsigned i = 64 * m; i-- > 0;) {
+			// `R = R << 1 | bit`
+			uint64_t bit = pU[i / 64] >> (i & 63) & 1;
+			for (unsigned j = 0; j <= n; j++) {
+				uint64_t next = pR[j] >> 63;
+				pR[j] = pR[j] << 1 | bit;
+				bit = next;
+			}
+
+			// `R >= V`
+			unsigned j = n;
+			bool fits = pR[n] != 0;
+			if (!fits) {
+				while (j-- > 0 && pR[j] == pV[j])
+					;
+				fits = j == ~0U || pR[j] > pV[j];
+			}
+
+			if (fits) {
+				pR[n] -= BIGMUL::sub(pR, pR, pV, n);
+				pQ[i / 64] |= 1ULL << (i & 63);
+			}
+		}
+
+		memset(pU, 0, m * sizeof *pU);
+		memcpy(pU, pR, (n < m ? n : m) * sizeof *pU);
+	}
+
+	/*
+	 * @date 2026-10-16 22:57:24
+	 *
+	 * Knuth algorithm D, `pQ[0..m-n] = pU[0..m) / pV[0..n)`, remainder in `pU[0..n)`, `pU[n..m]` cleared.
+	 * Divisor and dividend are normalised in place, the divisor is restored.
+	 *
+	 * @param pQ - quotient, `m-n+1` limbs
+	 * @param pU - dividend, `m+1` limbs, replaced by remainder
+	 * @param pV - divisor, top limb not zero, `n <= m`
+	 */
+	static void knuth(uint64_t *pQ, uint64_t *pU, unsigned m, uint64_t *pV, unsigned n) {
+		// single limb divisor
+		if (n == 1) {
+			unsigned __int128 rem = 0;
+			for (unsigned i = m; i-- > 0;) {
+				unsigned __int128 cur = rem << 64 | pU[i];
+				pQ[i] = cur / pV[0];
+				rem = cur % pV[0];
+			}
+			memset(pU, 0, (m + 1) * sizeof *pU);
+			pU[0] = rem;
+			return;
+		}
+
+		// normalise, top bit of divisor set
+		unsigned s = __builtin_clzll(pV[n - 1]);
+		if (s) {
+			for (unsigned i = n; i-- > 1;)
+				pV[i] = pV[i] << s | pV[i - 1] >> (64 - s);
+			pV[0] <<= s;
+			pU[m] = pU[m - 1] >> (64 - s);
+			for (unsigned i = m; i-- > 1;)
+				pU[i] = pU[i] << s | pU[i - 1] >> (64 - s);
+			pU[0] <<= s;
+		} else {
+			pU[m] = 0;
+		}
+
+		for (unsigned j = m - n + 1; j-- > 0;) {
+			// estimate from the top two limbs, the estimate is at most 2 too high
+			unsigned __int128 num = (unsigned __int128) pU[j + n] << 64 | pU[j + n - 1];
+			unsigned __int128 qhat = num / pV[n - 1];
+			unsigned __int128 rhat = num % pV[n - 1];
+			while (qhat >> 64 || qhat * pV[n - 2] > (rhat << 64 | pU[j + n - 2])) {
+				qhat--;
+				rhat += pV[n - 1];
+				if (rhat >> 64)
+					break;
+			}
+
+			// `U -= qhat * V`
+			uint64_t carry = 0, borrow = 0;
+			for (unsigned i = 0; i < n; i++) {
+				unsigned __int128 p = qhat * pV[i] + carry;
+				carry = p >> 64;
+				uint64_t t;
+				borrow = __builtin_sub_overflow(pU[i + j], (uint64_t) p, &t) | __builtin_sub_overflow(t, borrow, &t);
+				pU[i + j] = t;
+			}
+			uint64_t t;
+			borrow = __builtin_sub_overflow(pU[j + n], carry, &t) | __builtin_sub_overflow(t, borrow, &t);
+			pU[j + n] = t;
+
+			// estimate was one too high, add back
+			if (borrow) {
+				qhat--;
+				pU[j + n] += BIGMUL::add(pU + j, pU + j, pV, n);
+			}
+			pQ[j] = qhat;
+		}
+
+		// denormalise
+		if (s) {
+			for (unsigned i = 0; i < n - 1; i++)
+				pU[i] = pU[i] >> s | pU[i + 1] << (64 - s);
+			pU[n - 1] >>= s;
+			for (unsigned i = 0; i < n - 1; i++)
+				pV[i] = pV[i] >> s | pV[i + 1] << (64 - s);
+			pV[n - 1] >>= s;
+		}
+		memset(pU + n, 0, (m + 1 - n) * sizeof *pU);
+	}
+};
+
+/**
+ * @date 2020-07-15 00:52:43
+ *
+ * Operatore/instructions
+ *
+ * @date 2026-10-16 18:25:31
+ *
+ * Templated on the maximum runlength `RUNN` of the ports.
+ */
+template<unsigned RUNN>
+struct ALU {
+
+	/*
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * Mode of ADD/SUB. When set, operate on chunks of `INCHUNK::CHUNK` bits instead of bit-serial.
+	 * Both modes produce identical output.
+	 *
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Also MUL, which decodes both operands into limbs and multiplies with `BIGMUL`.
+	 *
+	 * @date 2026-10-16 22:57:24
+	 *
+	 * DIV/MOD always decode into limbs, the mode selects a quotient limb (Knuth) or a quotient bit (restoring) per step.
+	 */
+	bool limbs;
+
+	/*
+	 * @date 2026-10-16 21:08:33
+	 *
+	 * Native fast path. When set, operands that fit a machine word are decoded,
+	 * the operation performed natively, and the result encoded with `OUTBIT::encode()`.
+	 * Falls back to streaming when an operand is longer or the result could exceed the word.
+	 * The value of the result is the same, its encoding is the shortest instead of one bit longer than the longest operand.
+	 */
+	bool native;
+
+	/*
+	 * @date 2026-10-16 21:52:08
+	 *
+	 * Partial-product window of `MUL`, grown on demand.
+	 * Word `i` of the left history, right history and accumulator are stored together at `pWindow[3*i]`.
+	 */
+	uint64_t *pWindow;
+	unsigned capacity; // allocated words per row of `pWindow`
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Limb mode of `MUL`: limbs of left-hand-side, right-hand-side and product, grown on demand.
+	 *
+	 * @date 2026-10-16 22:57:24
+	 *
+	 * Also `DIV`/`MOD`: dividend then remainder, divisor, quotient and the partial remainder of restoring division.
+	 */
+	uint64_t *pLimbs[4];
+	unsigned numLimbs[4]; // allocated limbs of `pLimbs`
+	BIGMUL bigmul;
+
+	/*
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * Constructor/Initialise
+	 */
+	inline ALU() : limbs(true), native(true), pWindow(NULL), capacity(0), pLimbs(), numLimbs() {
+	}
+
+	/*
+	 * @date 2026-10-16 21:52:08
+	 *
+	 * Release resources
+	 */
+	inline ~ALU() {
+		free(pWindow);
+		for (unsigned k = 0; k < 4; k++)
+			free(pLimbs[k]);
+	}
+
+	// the window is owned
+	ALU(const ALU &) = delete;
+	ALU &operator=(const ALU &) = delete;
+
+	/*
+	 * @date 2026-10-16 21:08:33
+	 *
+	 * Native fast path: decode both operands when they fit a machine word.
+	 * The probe `INBIT::fitsword()` only looks at the first 64 raw bits, long operands are left to the streaming path.
+	 * Ports are left as the streaming path would.
+	 *
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 * @param {int64_t} lval - decoded left-hand-side
+	 * @param {int64_t} rval - decoded right-hand-side
+	 * @return {boolean} - `true` when both operands are decoded
+	 */
+	inline bool fetch(INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR, int64_t &lval, int64_t &rval) {
+		if (!native || !L.fitsword(iL) || !R.fitsword(iR))
+			return false;
+
+		unsigned iEnd;
+		lval = kernel<RUNN>().decode(L.pBase, iL, &iEnd);
+		L.stop(iEnd, lval < 0);
+		rval = kernel<RUNN>().decode(R.pBase, iR, &iEnd);
+		R.stop(iEnd, rval < 0);
+
+		return true;
+	}
+
+	/*
+	 * @date 2026-10-16 20:47:15
+	 *
+	 * Streaming ADD/SUB on limbs
+	 *
+	 * Operands are decoded a chunk at a time, added as whole words and the sum re-encoded with `OUTBIT::emitdata()`.
+	 * Only one chunk of each operand is held, the operation remains streaming.
+	 * The carry out of a chunk is the bit above it.
+	 * Same as the bit-serial loop, the result has max(left,right)+1 data bits
+	 * and the bit after that, which the carry logic produces from the polarities of the operands, is end-of-sequence polarity.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	template<bool SUBTRACT>
+	inline void limbADD(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+		enum {
+			CHUNK = INCHUNK<RUNN>::CHUNK,
+		};
+		static constexpr uint64_t MASK = (1ULL << CHUNK) - 1;
+
+		// start engines
+		void (*refill)(INCHUNK<RUNN> &chunk, const unsigned char *pBase) = kernel<RUNN>().refill;
+		INCHUNK<RUNN> l, r;
+		out.start(iOut);
+		l.start(iL);
+		r.start(iR);
+
+		// operator SUB equals ADD(L,R^!) with inverted carry
+		uint64_t carry = SUBTRACT;
+		unsigned done = 0; // data bits emitted
+
+		for (;;) {
+			// load next chunk of input pipelines
+			refill(l, L.pBase);
+			refill(r, R.pBase);
+
+			uint64_t sum = (l.peek() & MASK) + ((SUBTRACT ? ~r.peek() : r.peek()) & MASK) + carry;
+			carry = sum >> CHUNK;
+
+			// when both operands are decoded, the length of the result is known
+			if (l.row & r.row & DECODEBYTE::EOS) {
+				unsigned last = (l.total > r.total ? l.total : r.total) + 1 - done;
+
+				if (last < CHUNK) {
+					bool polarity = (sum >> last) & 1;
+
+					// emit operator result, end-of-sequence marker and finalise
+					out.emitdata(sum, last);
+					out.emitEOSS(polarity);
+					out.emitraw(polarity);
+					break;
+				}
+			}
+
+			// emit operator result
+			out.emitdata(sum, CHUNK);
+			l.consume(CHUNK);
+			r.consume(CHUNK);
+			done += CHUNK;
+		}
+
+		// write to memory
+		out.flush();
+
+		// leave ports as the bit-serial loop does
+		l.stop(L);
+		r.stop(R);
+	}
+
+	/*
+	 * @date 2020-07-08 18:56:29
+	 *
+	 * Streaming ADD
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void ADD(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		int64_t lval, rval, num;
+		if (fetch(L, iL, R, iR, lval, rval) && !__builtin_add_overflow(lval, rval, &num)) {
+			out.encode(iOut, num);
+			return;
+		}
+
+		if (limbs) {
+			limbADD<false>(out, iOut, L, iL, R, iR);
+			return;
+		}
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		bool ebit = 0;
+		bool carry = 0;
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			// operator SUB equals ADD(L,R^!) with inverted carry 
+			ebit = carry ^ L.bit ^ R.bit;
+			carry = carry ? L.bit | R.bit : L.bit & R.bit;
+
+			// emit operator result
+			out.emitbit(ebit);
+		} while (L.state || R.state);
+
+		// operator on final polarity
+		bool polarity = carry ^ L.bit ^ R.bit;
+
+		/*
+		 * @date 2020-07-15 12:11:26
+		 * The final carry(`ebit`) needs to be emitted which makes the result 1 bit longer.
+		 * Piggyback end-of-sequence-polarity of current streak of same polarity.
+		 * Let the caller finalise the end-of-sequence.
+		 */
+		out.emitEOSS(polarity);
+
+		// finalise end-of-sequence
+		out.emitraw(polarity);
+
+		// write to memory
+		out.flush();
+	}
+
+	/*
+	 * @date 2020-07-08 18:56:29
+	 *
+	 * Streaming SUB
+	 *
+	 * NOTE: identical to `ADD` except right-hand-side and carry are inverted
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void SUB(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		int64_t lval, rval, num;
+		if (fetch(L, iL, R, iR, lval, rval) && !__builtin_sub_overflow(lval, rval, &num)) {
+			out.encode(iOut, num);
+			return;
+		}
+
+		if (limbs) {
+			limbADD<true>(out, iOut, L, iL, R, iR);
+			return;
+		}
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		bool ebit = 0;
+		bool carry = 1;
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			// operator SUB equals ADD(L,R^!) with inverted carry 
+			ebit = carry ^ L.bit ^ R.bit ^ 1;
+			carry = carry ? L.bit | (R.bit ^ 1) : L.bit & (R.bit ^ 1);
+
+			// emit operator result
+			out.emitbit(ebit);
+		} while (L.state || R.state);
+
+		// operator on final polarity
+		bool polarity = (carry ^ 1) ^ L.bit ^ R.bit;
+
+		/*
+		 * @date 2020-07-15 12:11:26
+		 * The final carry(`ebit`) needs to be emitted which makes the result 1 bit longer.
+		 * Piggyback end-of-sequence-polarity of current streak of same polarity.
+		 * Let the caller finalise the end-of-sequence.
+		 */
+		out.emitEOSS(polarity);
+
+		// finalise end-of-sequence
+		out.emitraw(polarity);
+
+		// write to memory
+		out.flush();
+	}
+
+	/*
+	 * @date 2026-10-16 21:52:08
+	 *
+	 * One column of `MUL`: add the partial products of the new bits `l` and `r` to the accumulator, emit its lowest bit.
+	 *
+	 * After step `k` no later partial product reaches bit `k`, the accumulator is shifted right to keep it aligned.
+	 * The accumulator is below `2^(k+2)`, the window is `k/64+2` words wide.
+	 *
+	 * @param {boolean} l - bit `k` of left-hand-side
+	 * @param {boolean} r - bit `k` of right-hand-side
+	 * @param {number} k - bit position of result
+	 * @return {boolean} - bit `k` of result
+	 */
+	inline bool mulstep(bool l, bool r, unsigned k) {
+		unsigned numWords = k / 64 + 2;
+
+		if (!(k & 63)) {
+			// grow window, layout is preserved by `realloc()`
+			if (numWords > capacity) {
+				capacity = capacity ? capacity * 2 : 8;
+				pWindow = (uint64_t *) realloc(pWindow, 3 * capacity * sizeof *pWindow);
+				if (!pWindow) {
+					fprintf(stderr, "out of memory\n");
+					exit(1);
+				}
+			}
+			// clear the words entering the window
+			if (!k)
+				memset(pWindow, 0, 3 * sizeof *pWindow);
+			memset(pWindow + 3 * (numWords - 1), 0, 3 * sizeof *pWindow);
+		}
+
+		// `r_k` pairs with `l_0..l_k`, `l_k` with `r_0..r_(k-1)`
+		pWindow[3 * (k / 64) + 1] |= (uint64_t) r << (k & 63);
+
+		uint64_t maskL = -(uint64_t) l, maskR = -(uint64_t) r;
+		uint64_t carry = 0, prev = 0;
+		bool ebit = 0;
+		for (unsigned i = 0; i < numWords; i++) {
+			uint64_t *pWord = pWindow + 3 * i;
+			uint64_t sum = pWord[2], c0, c1, c2;
+
+			c0 = __builtin_add_overflow(sum, pWord[1] & maskL, &sum);
+			c1 = __builtin_add_overflow(sum, pWord[0] & maskR, &sum);
+			c2 = __builtin_add_overflow(sum, carry, &sum);
+			carry = c0 + c1 + c2;
+
+			if (i)
+				pWord[-1] = prev >> 1 | sum << 63;
+			else
+				ebit = sum & 1;
+			prev = sum;
+		}
+		pWindow[3 * numWords - 1] = prev >> 1;
+
+		pWindow[3 * (k / 64)] |= (uint64_t) l << (k & 63);
+
+		return ebit;
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Grow `pLimbs[k]` to at least `n` limbs, contents are preserved
+	 */
+	inline uint64_t *reserve(unsigned k, unsigned n) {
+		if (n > numLimbs[k]) {
+			numLimbs[k] = n > 2 * numLimbs[k] ? n : 2 * numLimbs[k];
+			pLimbs[k] = (uint64_t *) realloc(pLimbs[k], numLimbs[k] * sizeof *pLimbs[k]);
+			if (!pLimbs[k]) {
+				fprintf(stderr, "out of memory\n");
+				exit(1);
+			}
+		}
+		return pLimbs[k];
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * Decode a complete operand into `pLimbs[k]`, two's complement with at least one bit of polarity.
+	 * Data is decoded a chunk at a time by the kernel `refill`.
+	 *
+	 * @param port - memory port of operand, left as the bit-serial loop does
+	 * @param {number} pos - location of operand
+	 * @param {number} k - index of `pLimbs`
+	 * @return {number} - number of limbs
+	 */
+	inline unsigned decodeLimbs(INBIT<RUNN> &port, unsigned pos, unsigned k) {
+		enum {
+			CHUNK = INCHUNK<RUNN>::CHUNK,
+		};
+		static constexpr uint64_t MASK = (1ULL << CHUNK) - 1;
+
+		void (*refill)(INCHUNK<RUNN> &chunk, const unsigned char *pBase) = kernel<RUNN>().refill;
+		INCHUNK<RUNN> chunk;
+		chunk.start(pos);
+
+		unsigned done = 0; // data bits stored
+		for (;;) {
+			refill(chunk, port.pBase);
+
+			uint64_t *pData = reserve(k, done / 64 + 2);
+			uint64_t data = chunk.peek() & MASK;
+			unsigned shift = done & 63;
+
+			if (shift)
+				pData[done / 64] |= data << shift;
+			else
+				pData[done / 64] = data;
+			if (shift + CHUNK > 64)
+				pData[done / 64 + 1] = data >> (64 - shift);
+			done += CHUNK;
+
+			// including the first bit of polarity
+			if ((chunk.row & DECODEBYTE::EOS) && done > chunk.total)
+				break;
+			chunk.consume(CHUNK);
+		}
+
+		// extend polarity over the last limb
+		unsigned n = chunk.total / 64 + 1;
+		unsigned r = chunk.total & 63;
+		uint64_t fill = -(uint64_t) (chunk.row & 1);
+		pLimbs[k][n - 1] = r ? (pLimbs[k][n - 1] & ((1ULL << r) - 1)) | fill << r : fill;
+
+		chunk.stop(port);
+		return n;
+	}
+
+	/*
+	 * @date 2026-10-16 22:13:40
+	 *
+	 * MUL in limb mode: decode both operands completely, multiply magnitudes with `BIGMUL`, encode the product.
+	 * Output is the shortest encoding of the product.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void limbMUL(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+		unsigned nL = decodeLimbs(L, iL, 0);
+		unsigned nR = decodeLimbs(R, iR, 1);
+		uint64_t *pL = pLimbs[0], *pR = pLimbs[1], *pProd = reserve(2, nL + nR);
+
+		// magnitudes
+		bool negL = pL[nL - 1] >> 63, negR = pR[nR - 1] >> 63;
+		if (negL)
+			BIGMUL::neg(pL, nL);
+		if (negR)
+			BIGMUL::neg(pR, nR);
+
+		bigmul.mul(pProd, pL, nL, pR, nR);
+		if (negL ^ negR)
+			BIGMUL::neg(pProd, nL + nR);
+
+		emitLimbs(out, iOut, pProd, nL + nR);
+	}
+
+	/*
+	 * @date 2026-10-16 22:57:24
+	 *
+	 * Encode two's complement limbs with the shortest encoding
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param pData - limbs, the top bit is the polarity
+	 * @param {number} n - number of limbs
+	 */
+	inline void emitLimbs(OUTBIT<RUNN> &out, unsigned iOut, const uint64_t *pData, unsigned n) {
+		// data bits up to the last that differs from polarity
+		bool polarity = pData[n - 1] >> 63;
+		uint64_t fill = -(uint64_t) polarity;
+		unsigned top = n;
+		while (top && pData[top - 1] == fill)
+			top--;
+		unsigned length = top ? 64 * top - __builtin_clzll(pData[top - 1] ^ fill) : 0;
+
+		out.start(iOut);
+		for (unsigned i = 0; i < length; i += 32) {
+			unsigned count = length - i < 32 ? length - i : 32;
+			out.emitdata(pData[i / 64] >> (i & 63) & ((1ULL << count) - 1), count);
+		}
+		out.emitEOSS(polarity);
+		out.emitraw(polarity);
+		out.flush();
+	}
+
+	/*
+	 * @date 2026-10-16 22:57:24
+	 *
+	 * Decode both operands completely and divide, truncating towards zero as C.
+	 * With `limbs` the magnitudes are divided a limb at a time (`BIGDIV::knuth()`), otherwise a bit at a time (`BIGDIV::restoring()`).
+	 * Leaves the quotient in `pLimbs[2]` and the remainder, with the sign of the dividend, in `pLimbs[0]`.
+	 * Division by zero has quotient -1 and the dividend as remainder.
+	 *
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 * @return {number} - number of limbs of quotient and remainder
+	 */
+	inline unsigned divmod(INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+		unsigned nL = decodeLimbs(L, iL, 0);
+		unsigned nR = decodeLimbs(R, iR, 1);
+		uint64_t *pL = reserve(0, nL + 1), *pR = pLimbs[1], *pQuot = reserve(2, nL + 1);
+
+		// magnitudes, the dividend gets a limb for the sign of the results
+		bool negL = pL[nL - 1] >> 63, negR = pR[nR - 1] >> 63;
+		if (negL)
+			BIGMUL::neg(pL, nL);
+		if (negR)
+			BIGMUL::neg(pR, nR);
+		pL[nL] = 0;
+		memset(pQuot, 0, (nL + 1) * sizeof *pQuot);
+
+		// significant limbs
+		unsigned m = nL, n = nR;
+		while (m && !pL[m - 1])
+			m--;
+		while (n && !pR[n - 1])
+			n--;
+
+		if (!n) {
+			// division by zero
+			memset(pQuot, 0xff, (nL + 1) * sizeof *pQuot);
+			negR = negL;
+		} else if (m < n) {
+			// quotient is zero, remainder is dividend
+		} else if (limbs) {
+			BIGDIV::knuth(pQuot, pL, m, pR, n);
+		} else {
+			BIGDIV::restoring(pQuot, pL, m, pR, n, reserve(3, n + 1));
+		}
+
+		// quotient is negative when signs differ, remainder has the sign of the dividend
+		if (negL ^ negR)
+			BIGMUL::neg(pQuot, nL + 1);
+		if (negL)
+			BIGMUL::neg(pL, nL + 1);
+
+		return nL + 1;
+	}
+
+	/*
+	 * @date 2026-10-16 21:52:08
+	 *
+	 * Streaming MUL
+	 *
+	 * Result bits are emitted LSB first, one per column, while operands are read.
+	 * The partial-product window holds the operand bits read so far and the pending column sums.
+	 * Operands past their end-of-sequence continue with their polarity.
+	 * At least the last `RUNN-1` data bits of an operand equal its polarity, an escape counts as the first bit of the final run.
+	 * The product of operands with `nL` and `nR` data bits fits `nL+nR-2*RUNN+4` bits, the last being the polarity.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void MUL(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		int64_t lval, rval, num;
+		if (fetch(L, iL, R, iR, lval, rval) && !__builtin_mul_overflow(lval, rval, &num)) {
+			out.encode(iOut, num);
+			return;
+		}
+
+		if (limbs) {
+			limbMUL(out, iOut, L, iL, R, iR);
+			return;
+		}
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		unsigned k = 0;
+		unsigned nL = 0, nR = 0; // number of data bits
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			if (L.state)
+				nL = k + 1;
+			if (R.state)
+				nR = k + 1;
+
+			// emit operator result
+			out.emitbit(mulstep(L.bit, R.bit, k++));
+		} while (L.state || R.state || k + 2 * RUNN <= nL + nR + 2);
+
+		// operator on final polarity
+		bool polarity = mulstep(L.bit, R.bit, k);
+
+		// end-of-sequence marker
+		out.emitEOSS(polarity);
+
+		// finalise end-of-sequence
+		out.emitraw(polarity);
+
+		// write to memory
+		out.flush();
+	}
+
+	/*
+	 * @date 2026-10-16 22:57:24
+	 *
+	 * DIV, quotient truncated towards zero as C
+	 *
+	 * Division needs the most significant bits first, both operands are decoded completely.
+	 * Division by zero returns -1.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void DIV(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		// `INT64_MIN / -1` overflows
+		int64_t lval, rval;
+		if (fetch(L, iL, R, iR, lval, rval) && (lval != INT64_MIN || rval != -1)) {
+			out.encode(iOut, rval ? lval / rval : -1);
+			return;
+		}
+
+		unsigned n = divmod(L, iL, R, iR);
+		emitLimbs(out, iOut, pLimbs[2], n);
+	}
+
+	/*
+	 * @date 2026-10-16 22:57:24
+	 *
+	 * MOD, remainder has the sign of the dividend as C
+	 *
+	 * Division by zero returns the dividend.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void MOD(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		// `INT64_MIN % -1` traps
+		int64_t lval, rval;
+		if (fetch(L, iL, R, iR, lval, rval) && (lval != INT64_MIN || rval != -1)) {
+			out.encode(iOut, rval ? lval % rval : lval);
+			return;
+		}
+
+		unsigned n = divmod(L, iL, R, iR);
+		emitLimbs(out, iOut, pLimbs[0], n);
+	}
+
+	/**
+	 * @date 2020-07-15 12:36:50
+	 *
+	 * Logical shift left
+	 *
+	 * Left-hand-side is streaming
+	 * Right-hand-side is enumerated and large values can critically impact operations.
+	 * 
+	 * @date 2020-07-15 01:42:12
+	 * 
+	 * The shiftcount is most likely to be less than the length of the sequential memory storage.
+	 * right-hand-side could also be a string of which the length determines the shift count. 
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void LSL(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		int64_t lval, rval;
+		if (fetch(L, iL, R, iR, lval, rval)) {
+			// negative shift count emits no "0"
+			if (rval <= 0) {
+				out.encode(iOut, lval);
+				return;
+			}
+			// shift is exact when no significant bits are lost
+			int64_t num = (uint64_t) lval << (rval & 63);
+			if (rval < 63 && num >> rval == lval) {
+				out.encode(iOut, num);
+				return;
+			}
+		}
+
+		// decode rval
+		unsigned iEnd;
+		rval = kernel<RUNN>().decode(R.pBase, iR, &iEnd);
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+
+		// emit `rval` number of "0"
+		while (rval > 0) {
+			out.emitbit(0);
+			--rval;
+		}
+
+		// Copy lval to output
+		do {
+			L.nextbit();
+			out.emitbit(L.bit);
+		} while (L.state);
+
+		// end-of-sequence marker
+		out.emitEOSS(L.bit);
+
+		// finalise end-of-sequence
+		out.emitraw(L.bit);
+
+		// write to memory
+		out.flush();
+	}
+
+	/**
+	 * @date 2020-07-15 12:39:51
+	 *
+	 * Logical shift right
+	 *
+	 * Left-hand-side is streaming
+	 * Right-hand-size is enumerated and large values can critically impact operations.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void LSR(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		int64_t lval, rval;
+		if (fetch(L, iL, R, iR, lval, rval)) {
+			// negative shift count skips no bits, shifting out all bits leaves the polarity
+			out.encode(iOut, rval <= 0 ? lval : lval >> (rval < 63 ? rval : 63));
+			return;
+		}
+
+		// decode rval
+		unsigned iEnd;
+		rval = kernel<RUNN>().decode(R.pBase, iR, &iEnd);
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+
+		// Copy lval to output skipping first `rval` bits
+		do {
+			L.nextbit();
+			if (--rval < 0)
+				out.emitbit(L.bit);
+		} while (L.state);
+
+		// end-of-sequence marker
+		out.emitEOSS(L.bit);
+
+		// finalise end-of-sequence
+		out.emitraw(L.bit);
+
+		// write to memory
+		out.flush();
+	}
+
+	/**
+	 * @date 2020-07-15 12:22:27
+	 *
+	 * Streaming AND
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void AND(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		int64_t lval, rval;
+		if (fetch(L, iL, R, iR, lval, rval)) {
+			out.encode(iOut, lval & rval);
+			return;
+		}
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			// operator 
+			bool ebit = L.bit & R.bit;
+
+			// emit operator result
+			out.emitbit(ebit);
+		} while (L.state || R.state);
+
+		// final polarity
+		bool polarity = L.bit & R.bit;
+
+		// end-of-sequence marker
+		out.emitEOSS(polarity);
+
+		// finalise end-of-sequence
+		out.emitraw(polarity);
+
+		// write to memory
+		out.flush();
+	}
+
+	/**
+	 * @date 2020-07-15 12:31:06
+	 *
+	 * Streaming XOR
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void XOR(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		int64_t lval, rval;
+		if (fetch(L, iL, R, iR, lval, rval)) {
+			out.encode(iOut, lval ^ rval);
+			return;
+		}
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			// operator 
+			bool ebit = L.bit ^ R.bit;
+
+			// emit operator result
+			out.emitbit(ebit);
+		} while (L.state || R.state);
+
+		// final polarity
+		bool polarity = L.bit ^ R.bit;
+
+		// end-of-sequence marker
+		out.emitEOSS(polarity);
+
+		// finalise end-of-sequence
+		out.emitraw(polarity);
+
+		// write to memory
+		out.flush();
+	}
+
+	/**
+	 * @date 2020-07-15 12:32:23
+	 *
+	 * Streaming OR
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void OR(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+
+		int64_t lval, rval;
+		if (fetch(L, iL, R, iR, lval, rval)) {
+			out.encode(iOut, lval | rval);
+			return;
+		}
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			// operator 
+			bool ebit = L.bit | R.bit;
+
+			// emit operator result
+			out.emitbit(ebit);
+		} while (L.state || R.state);
+
+		// final polarity
+		bool polarity = L.bit | R.bit;
+
+		// end-of-sequence marker
+		out.emitEOSS(polarity);
+
+		// finalise end-of-sequence
+		out.emitraw(polarity);
+
+		// write to memory
+		out.flush();
+	}
+
+	/*
+	 * @date 2026-10-16 23:40:02
+	 *
+	 * Fused `L <op> (R << fill)` in limb mode, same output as `shiftOP()`.
+	 * The right-hand-side chunk is delayed by `fill` data bits: zero while `fill` is ahead, then shifted into the chunk once and consumed short.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 * @param {number} fill - shift count of right-hand-side
+	 */
+	template<unsigned OPCODE>
+	inline void limbShift(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR, unsigned fill) {
+		enum {
+			CHUNK = INCHUNK<RUNN>::CHUNK,
+		};
+		static constexpr uint64_t MASK = (1ULL << CHUNK) - 1;
+
+		// start engines
+		void (*refill)(INCHUNK<RUNN> &chunk, const unsigned char *pBase) = kernel<RUNN>().refill;
+		INCHUNK<RUNN> l, r;
+		out.start(iOut);
+		l.start(iL);
+		r.start(iR);
+
+		// operator SUB equals ADD(L,R^!) with inverted carry
+		uint64_t carry = OPCODE == OP_SUB;
+		unsigned done = 0; // data bits emitted
+
+		for (;;) {
+			// load next chunk of input pipelines
+			refill(l, L.pBase);
+			refill(r, R.pBase);
+
+			// delay line
+			unsigned delay = fill > done ? fill - done : 0;
+			uint64_t rdata = delay < CHUNK ? r.peek() << delay : 0;
+
+			uint64_t sum;
+			if (OPCODE == OP_OR) {
+				sum = l.peek() | rdata;
+			} else {
+				sum = (l.peek() & MASK) + ((OPCODE == OP_SUB ? ~rdata : rdata) & MASK) + carry;
+				carry = sum >> CHUNK;
+			}
+
+			// when both operands are decoded, the length of the result is known
+			if (l.row & r.row & DECODEBYTE::EOS) {
+				unsigned left = l.total, right = r.total + fill;
+				unsigned last = (left > right ? left : right) + 1 - done;
+
+				if (last < CHUNK) {
+					bool polarity = (sum >> last) & 1;
+
+					// emit operator result, end-of-sequence marker and finalise
+					out.emitdata(sum, last);
+					out.emitEOSS(polarity);
+					out.emitraw(polarity);
+					break;
+				}
+			}
+
+			// emit operator result
+			out.emitdata(sum, CHUNK);
+			l.consume(CHUNK);
+			if (delay < CHUNK)
+				r.consume(CHUNK - delay);
+			done += CHUNK;
+		}
+
+		// write to memory
+		out.flush();
+
+		// leave ports as the bit-serial loop does
+		l.stop(L);
+		r.stop(R);
+	}
+
+	/*
+	 * @date 2026-10-16 23:40:02
+	 *
+	 * Fused `L <op> (R << fill)`, the `shiftAdd(DST, LEFT, RIGHT, FILL)` of `div.c`.
+	 *
+	 * The right-hand-side is read with a delay of `fill` columns, during which it contributes zeros.
+	 * The shifted right-hand-side is never stored, unlike `LSL` followed by the operator.
+	 * Result and end-of-sequence are as the operator on the shifted value.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 * @param {number} fill - shift count of right-hand-side
+	 */
+	template<unsigned OPCODE>
+	inline void shiftOP(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR, unsigned fill) {
+
+		// native when the shifted right-hand-side and the result fit
+		int64_t lval, rval, num;
+		if (fetch(L, iL, R, iR, lval, rval) && fill < 63 && (int64_t) ((uint64_t) rval << fill) >> fill == rval) {
+			int64_t shifted = (uint64_t) rval << fill;
+			bool overflow = false;
+			switch (OPCODE) {
+			case OP_ADD: overflow = __builtin_add_overflow(lval, shifted, &num); break;
+			case OP_SUB: overflow = __builtin_sub_overflow(lval, shifted, &num); break;
+			case OP_OR: num = lval | shifted; break;
+			}
+			if (!overflow) {
+				out.encode(iOut, num);
+				return;
+			}
+		}
+
+		if (limbs) {
+			limbShift<OPCODE>(out, iOut, L, iL, R, iR, fill);
+			return;
+		}
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		bool carry = OPCODE == OP_SUB;
+		bool ebit = 0;
+		bool rbit = 0;
+		unsigned k = 0;
+
+		do {
+			// load next data bit of input pipelines, right-hand-side after the delay
+			L.nextbit();
+			if (k >= fill) {
+				R.nextbit();
+				rbit = R.bit;
+			}
+			k++;
+
+			// operator SUB equals ADD(L,R^!) with inverted carry
+			bool r = OPCODE == OP_SUB ? !rbit : rbit;
+			if (OPCODE == OP_OR) {
+				ebit = L.bit | r;
+			} else {
+				ebit = carry ^ L.bit ^ r;
+				carry = carry ? L.bit | r : L.bit & r;
+			}
+
+			// emit operator result
+			out.emitbit(ebit);
+		} while (L.state || R.state);
+
+		// operator on final polarity
+		bool r = OPCODE == OP_SUB ? !R.bit : R.bit;
+		bool polarity = OPCODE == OP_OR ? L.bit | r : carry ^ L.bit ^ r;
+
+		// end-of-sequence marker
+		out.emitEOSS(polarity);
+
+		// finalise end-of-sequence
+		out.emitraw(polarity);
+
+		// write to memory
+		out.flush();
+	}
+
+	/*
+	 * @date 2026-10-16 23:40:02
+	 *
+	 * Streaming `L + (R << fill)`
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 * @param {number} fill - shift count of right-hand-side
+	 */
+	inline void shiftADD(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR, unsigned fill) {
+		shiftOP<OP_ADD>(out, iOut, L, iL, R, iR, fill);
+	}
+
+	/*
+	 * @date 2026-10-16 23:40:02
+	 *
+	 * Streaming `L - (R << fill)`
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 * @param {number} fill - shift count of right-hand-side
+	 */
+	inline void shiftSUB(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR, unsigned fill) {
+		shiftOP<OP_SUB>(out, iOut, L, iL, R, iR, fill);
+	}
+
+	/*
+	 * @date 2026-10-16 23:40:02
+	 *
+	 * Streaming `L | (R << fill)`
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 * @param {number} fill - shift count of right-hand-side
+	 */
+	inline void shiftOR(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR, unsigned fill) {
+		shiftOP<OP_OR>(out, iOut, L, iL, R, iR, fill);
+	}
+};
+
+/**
+ * @date 2026-10-16 18:41:07
+ *
+ * Operators/instructions for unsigned ports.
+ *
+ * Same as `ALU`, the end-of-sequence polarity is always "0".
+ * The last iteration, where both inputs have reached end-of-sequence, emits the pending carry.
+ */
+template<unsigned RUNN>
+struct UALU {
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Streaming ADD
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void ADD(UOUTBIT<RUNN> &out, unsigned iOut, UINBIT<RUNN> &L, unsigned iL, UINBIT<RUNN> &R, unsigned iR) {
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		bool ebit = 0;
+		bool carry = 0;
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			ebit = carry ^ L.bit ^ R.bit;
+			carry = carry ? L.bit | R.bit : L.bit & R.bit;
+
+			// emit operator result
+			out.emitbit(ebit);
+		} while (L.state || R.state);
+
+		// end-of-sequence marker
+		out.emitEOSS();
+
+		// finalise end-of-sequence
+		out.emitraw(0);
+
+		// write to memory
+		out.flush();
+	}
+
+	/*
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Streaming SUB
+	 *
+	 * When left-hand-side is smaller than right-hand-side the result would need infinite leading "1".
+	 * The emitted result is then the two's complement truncated to the length of the longest operand plus one,
+	 * and the borrow is returned for the caller to act upon.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 * @return {boolean} - borrow, `true` when left-hand-side < right-hand-side
+	 */
+	inline bool SUB(UOUTBIT<RUNN> &out, unsigned iOut, UINBIT<RUNN> &L, unsigned iL, UINBIT<RUNN> &R, unsigned iR) {
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		bool ebit = 0;
+		bool borrow = 0;
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			ebit = borrow ^ L.bit ^ R.bit;
+			borrow = borrow ? !L.bit | R.bit : !L.bit & R.bit;
+
+			// emit operator result
+			out.emitbit(ebit);
+		} while (L.state || R.state);
+
+		// end-of-sequence marker
+		out.emitEOSS();
+
+		// finalise end-of-sequence
+		out.emitraw(0);
+
+		// write to memory
+		out.flush();
+
+		return borrow;
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Logical shift left
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void LSL(UOUTBIT<RUNN> &out, unsigned iOut, UINBIT<RUNN> &L, unsigned iL, UINBIT<RUNN> &R, unsigned iR) {
+
+		// decode rval
+		unsigned iEnd;
+		uint64_t rval = kernel<RUNN>().udecode(R.pBase, iR, &iEnd);
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+
+		// emit `rval` number of "0"
+		while (rval > 0) {
+			out.emitbit(0);
+			--rval;
+		}
+
+		// Copy lval to output
+		do {
+			L.nextbit();
+			out.emitbit(L.bit);
+		} while (L.state);
+
+		// end-of-sequence marker
+		out.emitEOSS();
+
+		// finalise end-of-sequence
+		out.emitraw(0);
+
+		// write to memory
+		out.flush();
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Logical shift right
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void LSR(UOUTBIT<RUNN> &out, unsigned iOut, UINBIT<RUNN> &L, unsigned iL, UINBIT<RUNN> &R, unsigned iR) {
+
+		// decode rval
+		unsigned iEnd;
+		uint64_t rval = kernel<RUNN>().udecode(R.pBase, iR, &iEnd);
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+
+		// Copy lval to output skipping first `rval` bits
+		do {
+			L.nextbit();
+			if (rval)
+				--rval;
+			else
+				out.emitbit(L.bit);
+		} while (L.state);
+
+		// end-of-sequence marker
+		out.emitEOSS();
+
+		// finalise end-of-sequence
+		out.emitraw(0);
+
+		// write to memory
+		out.flush();
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Streaming AND
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void AND(UOUTBIT<RUNN> &out, unsigned iOut, UINBIT<RUNN> &L, unsigned iL, UINBIT<RUNN> &R, unsigned iR) {
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			// operator
+			out.emitbit(L.bit & R.bit);
+		} while (L.state || R.state);
+
+		// end-of-sequence marker
+		out.emitEOSS();
+
+		// finalise end-of-sequence
+		out.emitraw(0);
+
+		// write to memory
+		out.flush();
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Streaming XOR
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void XOR(UOUTBIT<RUNN> &out, unsigned iOut, UINBIT<RUNN> &L, unsigned iL, UINBIT<RUNN> &R, unsigned iR) {
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			// operator
+			out.emitbit(L.bit ^ R.bit);
+		} while (L.state || R.state);
+
+		// end-of-sequence marker
+		out.emitEOSS();
+
+		// finalise end-of-sequence
+		out.emitraw(0);
+
+		// write to memory
+		out.flush();
+	}
+
+	/**
+	 * @date 2026-10-16 18:41:07
+	 *
+	 * Streaming OR
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void OR(UOUTBIT<RUNN> &out, unsigned iOut, UINBIT<RUNN> &L, unsigned iL, UINBIT<RUNN> &R, unsigned iR) {
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+		R.start(iR);
+
+		do {
+			// load next data bit of input pipelines
+			L.nextbit();
+			R.nextbit();
+
+			// operator
+			out.emitbit(L.bit | R.bit);
+		} while (L.state || R.state);
+
+		// end-of-sequence marker
+		out.emitEOSS();
+
+		// finalise end-of-sequence
+		out.emitraw(0);
+
+		// write to memory
+		out.flush();
+	}
+};
+
+/**
+ * @date 2026-10-16 20:24:52
+ *
+ * Bit-sliced batch of `ALU` operations, 64 independent operations per pass.
+ *
+ * The `bool` carry/ebit logic of `ALU` is applied to planes: bit `i` of a plane belongs to lane `i`.
+ * One plane operation performs the same data step for all 64 lanes.
+ *
+ * Per lane the inputs are decoded word-wise with `INCHUNK`, escapes removed and lengths recorded.
+ * A block of up to `STEPS` data bits per lane is transposed into planes, processed, and transposed back.
+ * The result of each lane is emitted with `OUTBIT::emitdata()`.
+ * Lanes terminate individually: the operation of a lane takes max(left,right)+1 data steps, as `ALU`,
+ * and the step after that yields its end-of-sequence polarity.
+ * Lanes that finish are refilled from the work queue at the next block.
+ *
+ * NOTE: Lanes are written concurrently. The output of a lane should not share bytes with inputs.
+ *
+ * @date 2026-10-17 03:14:37
+ *
+ * Outputs may be packed back to back. A lane holds the bits preceding its output in its first byte until it writes that byte.
+ * A lane that finishes refreshes those bits in the lanes that start in a byte it just wrote.
+ *
+ * @typedef {object} SLICEALU
+ */
+template<unsigned RUNN>
+struct SLICEALU {
+
+	enum {
+		LANES = 64, // bits per plane
+		STEPS = INCHUNK<RUNN>::CHUNK, // data steps per block
+	};
+
+	/*
+	 * @date 2026-10-16 20:24:52
+	 *
+	 * Context of a lane
+	 */
+	struct LANE {
+		INCHUNK<RUNN> L, R; // input ports
+		unsigned done;      // data steps processed
+
+		// saved state of the `OUTBIT` port
+		unsigned state;
+		bool bit;
+		unsigned char *pMem;
+		uint64_t word;
+		unsigned wordlen;
+
+		// first byte of output and number of preceding bits in it, belonging to whatever is before the output
+		unsigned char *pFirst;
+		unsigned prefix;
+	};
+
+	/*
+	 * @date 2026-10-16 20:24:52
+	 *
+	 * Transpose a 64x64 bit matrix: bit `c` of row `r` swaps with bit `r` of row `c`.
+	 * Swaps the off-diagonal quadrants of ever smaller blocks.
+	 */
+	static inline void transpose(uint64_t a[64]) {
+		uint64_t m = 0x00000000ffffffffULL; // columns in the lower half of the blocks
+
+		for (unsigned j = 32; j; j >>= 1, m ^= m << j) {
+			for (unsigned k = 0; k < 64; k = (k + j + 1) & ~j) {
+				uint64_t t = (a[k] >> j ^ a[k + j]) & m;
+				a[k] ^= t << j;
+				a[k + j] ^= t;
+			}
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 20:24:52
+	 *
+	 * Run `n` operations, the `i`th being `out[pOut[i]] = L[pL[i]] <OPCODE> R[pR[i]]`
+	 *
+	 * NOTE: The ports only supply the memory, the state of `L` and `R` is left untouched.
+	 */
+	template<unsigned OPCODE>
+	void run(OUTBIT<RUNN> &out, const unsigned *pOut, INBIT<RUNN> &L, const unsigned *pL, INBIT<RUNN> &R, const unsigned *pR, size_t n) {
+		void (*refill)(INCHUNK<RUNN> &chunk, const unsigned char *pBase) = kernel<RUNN>().refill;
+		LANE lanes[LANES];
+		uint64_t planeL[LANES], planeR[LANES], planeOut[LANES];
+		uint64_t live = 0; // lanes with an operation in progress
+		uint64_t carry = 0; // carry/borrow plane
+		size_t next = 0; // next operation from queue
+
+		for (;;) {
+			// assign operations to idle lanes
+			uint64_t fresh = 0;
+			for (uint64_t m = ~live; m && next < n; m &= m - 1, next++) {
+				LANE &lane = lanes[__builtin_ctzll(m)];
+
+				lane.L.start(pL[next]);
+				lane.R.start(pR[next]);
+				lane.done = 0;
+
+				out.start(pOut[next]);
+				lane.state = out.state;
+				lane.bit = out.bit;
+				lane.pMem = out.pMem;
+				lane.word = out.word;
+				lane.wordlen = out.wordlen;
+				lane.pFirst = out.pMem;
+				lane.prefix = out.wordlen;
+
+				fresh |= m & -m;
+			}
+			live |= fresh;
+
+			if (!live)
+				break;
+
+			// initial carry, SUB equals ADD(L,R^!) with inverted carry
+			carry = (carry & ~fresh) | (OPCODE == OP_SUB ? fresh : 0);
+
+			// load next block into lane rows, determine how many steps are needed
+			unsigned steps = 0;
+			for (unsigned i = 0; i < LANES; i++) {
+				if (!(live & (1ULL << i))) {
+					planeL[i] = planeR[i] = 0;
+					continue;
+				}
+
+				LANE &lane = lanes[i];
+				refill(lane.L, L.pBase);
+				refill(lane.R, R.pBase);
+				planeL[i] = lane.L.peek();
+				planeR[i] = lane.R.peek();
+
+				// steps to end-of-sequence polarity, when both inputs have been fully decoded
+				unsigned need = STEPS;
+				if (lane.L.row & lane.R.row & DECODEBYTE::EOS) {
+					need = (lane.L.total > lane.R.total ? lane.L.total : lane.R.total) + 2 - lane.done;
+					if (need > STEPS)
+						need = STEPS;
+				}
+				if (steps < need)
+					steps = need;
+			}
+
+			// lanes to planes
+			transpose(planeL);
+			transpose(planeR);
+
+			// operator, all lanes at once
+			for (unsigned t = 0; t < steps; t++) {
+				uint64_t l = planeL[t], r = planeR[t];
+
+				switch (OPCODE) {
+				case OP_ADD:
+					planeOut[t] = carry ^ l ^ r;
+					carry = (l & r) | (carry & (l ^ r));
+					break;
+				case OP_SUB:
+					planeOut[t] = carry ^ l ^ r ^ ~0ULL;
+					carry = (l & ~r) | (carry & (l ^ ~r));
+					break;
+				case OP_AND:
+					planeOut[t] = l & r;
+					break;
+				case OP_XOR:
+					planeOut[t] = l ^ r;
+					break;
+				case OP_OR:
+					planeOut[t] = l | r;
+					break;
+				}
+			}
+			for (unsigned t = steps; t < LANES; t++)
+				planeOut[t] = 0;
+
+			// planes to lanes
+			transpose(planeOut);
+
+			// emit results
+			for (uint64_t m = live; m; m &= m - 1) {
+				unsigned i = __builtin_ctzll(m);
+				LANE &lane = lanes[i];
+
+				out.state = lane.state;
+				out.bit = lane.bit;
+				out.pMem = lane.pMem;
+				out.word = lane.word;
+				out.wordlen = lane.wordlen;
+
+				// data steps of the lane, the step after is end-of-sequence polarity
+				unsigned last = ~0U;
+				if (lane.L.row & lane.R.row & DECODEBYTE::EOS)
+					last = (lane.L.total > lane.R.total ? lane.L.total : lane.R.total) + 1 - lane.done;
+
+				if (last < steps) {
+					bool polarity = (planeOut[i] >> last) & 1;
+
+					out.emitdata(planeOut[i], last);
+					out.emitEOSS(polarity);
+					out.emitraw(polarity);
+					out.flush();
+
+					live &= ~(1ULL << i);
+
+					// lanes that start in a byte just written and did not write it yet, take over the fresh preceding bits
+					const unsigned char *pEnd = out.pMem + (out.wordlen + 7) / 8;
+					for (uint64_t k = live; k; k &= k - 1) {
+						LANE &other = lanes[__builtin_ctzll(k)];
+						if (other.prefix && other.pMem == other.pFirst && other.pFirst >= out.pMem && other.pFirst < pEnd) {
+							uint64_t prefix = (1ULL << other.prefix) - 1;
+							other.word = (other.word & ~prefix) | (*other.pFirst & prefix);
+						}
+					}
+					continue;
+				}
+
+				out.emitdata(planeOut[i], steps);
+				lane.state = out.state;
+				lane.bit = out.bit;
+				lane.pMem = out.pMem;
+				lane.word = out.word;
+				lane.wordlen = out.wordlen;
+
+				lane.L.consume(steps);
+				lane.R.consume(steps);
+				lane.done += steps;
+			}
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 20:24:52
+	 *
+	 * Batch ADD
+	 *
+	 * @param out - memory port for results
+	 * @param pOut - locations of results
+	 * @param L - memory port left-hand-side
+	 * @param pL - locations of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param pR - locations right-hand-side
+	 * @param n - number of operations
+	 */
+	inline void ADD(OUTBIT<RUNN> &out, const unsigned *pOut, INBIT<RUNN> &L, const unsigned *pL, INBIT<RUNN> &R, const unsigned *pR, size_t n) {
+		run<OP_ADD>(out, pOut, L, pL, R, pR, n);
+	}
+
+	/*
+	 * @date 2026-10-16 20:24:52
+	 *
+	 * Batch SUB
+	 */
+	inline void SUB(OUTBIT<RUNN> &out, const unsigned *pOut, INBIT<RUNN> &L, const unsigned *pL, INBIT<RUNN> &R, const unsigned *pR, size_t n) {
+		run<OP_SUB>(out, pOut, L, pL, R, pR, n);
+	}
+
+	/*
+	 * @date 2026-10-16 20:24:52
+	 *
+	 * Batch AND
+	 */
+	inline void AND(OUTBIT<RUNN> &out, const unsigned *pOut, INBIT<RUNN> &L, const unsigned *pL, INBIT<RUNN> &R, const unsigned *pR, size_t n) {
+		run<OP_AND>(out, pOut, L, pL, R, pR, n);
+	}
+
+	/*
+	 * @date 2026-10-16 20:24:52
+	 *
+	 * Batch XOR
+	 */
+	inline void XOR(OUTBIT<RUNN> &out, const unsigned *pOut, INBIT<RUNN> &L, const unsigned *pL, INBIT<RUNN> &R, const unsigned *pR, size_t n) {
+		run<OP_XOR>(out, pOut, L, pL, R, pR, n);
+	}
+
+	/*
+	 * @date 2026-10-16 20:24:52
+	 *
+	 * Batch OR
+	 */
+	inline void OR(OUTBIT<RUNN> &out, const unsigned *pOut, INBIT<RUNN> &L, const unsigned *pL, INBIT<RUNN> &R, const unsigned *pR, size_t n) {
+		run<OP_OR>(out, pOut, L, pL, R, pR, n);
+	}
+};
+
+/*
+ * @date 2026-10-16 23:58:36
+ *
+ * Fixed-point values, "variable-width storage can keep a longer result for quasi fixed-point (fraction)".
+ *
+ * A value is the encoded number of fraction bits (`point`) immediately followed by the encoded mantissa, `value = mantissa * 2^-point`.
+ * `LSR` increases the point instead of dropping bits, operations are exact and the mantissa grows as needed.
+ * `ADD`/`SUB` align the operands with the fused `shiftADD`/`shiftSUB` of `ALU`.
+ * `FLOOR` converts to an integer.
+ *
+ * @typedef {object} FIXALU
+ */
+template<unsigned RUNN>
+struct FIXALU {
+
+	ALU<RUNN> alu;        // operators on mantissas
+	unsigned char *pWork; // work memory of intermediates
+	unsigned workBits;    // allocated bits of `pWork`
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Constructor/Initialise
+	 */
+	inline FIXALU() : pWork(NULL), workBits(0) {
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Release resources
+	 */
+	inline ~FIXALU() {
+		free(pWork);
+	}
+
+	// the work memory is owned
+	FIXALU(const FIXALU &) = delete;
+	FIXALU &operator=(const FIXALU &) = delete;
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Grow work memory to at least `bits`, contents are not preserved
+	 */
+	inline void reserve(unsigned bits) {
+		if (bits > workBits) {
+			workBits = bits;
+			free(pWork);
+			pWork = (unsigned char *) calloc(workBits / 8 + 16, 1);
+			if (!pWork) {
+				fprintf(stderr, "out of memory\n");
+				exit(1);
+			}
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Read the point of a fixed-point value
+	 *
+	 * @param port - memory port of value
+	 * @param {number} pos - location of value
+	 * @param {number} iMantissa - location of mantissa
+	 * @return {number} - number of fraction bits
+	 */
+	static inline unsigned point(INBIT<RUNN> &port, unsigned pos, unsigned &iMantissa) {
+		unsigned point = port.decode(pos);
+		iMantissa = port.skip(pos);
+		return point;
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Write the point of a fixed-point value
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param {number} point - number of fraction bits
+	 * @return {number} - location of mantissa
+	 */
+	static inline unsigned header(OUTBIT<RUNN> &out, unsigned iOut, unsigned point) {
+		out.encode(iOut, point);
+		return out.getpos();
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Encode `mantissa * 2^-point`
+	 */
+	static inline void encode(OUTBIT<RUNN> &out, unsigned iOut, int64_t mantissa, unsigned point) {
+		out.encode(header(out, iOut, point), mantissa);
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Copy mantissa to the output with a new point
+	 */
+	inline void copy(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iMantissa, unsigned point) {
+		INBIT<RUNN> V(L.pBase);
+		alu.OR(out, header(out, iOut, point), L, iMantissa, V, iMantissa);
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * ADD, exact, the point of the result is the larger of both
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void ADD(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+		unsigned iML, iMR;
+		unsigned pointL = point(L, iL, iML), pointR = point(R, iR, iMR);
+
+		if (pointL >= pointR)
+			alu.shiftADD(out, header(out, iOut, pointL), L, iML, R, iMR, pointL - pointR);
+		else
+			alu.shiftADD(out, header(out, iOut, pointR), R, iMR, L, iML, pointR - pointL);
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * SUB, exact, the point of the result is the larger of both
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void SUB(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+		unsigned iML, iMR;
+		unsigned pointL = point(L, iL, iML), pointR = point(R, iR, iMR);
+
+		if (pointL >= pointR) {
+			alu.shiftSUB(out, header(out, iOut, pointL), L, iML, R, iMR, pointL - pointR);
+			return;
+		}
+
+		// the left-hand-side is the shifted one, `0 + (L << fill)` in work memory first
+		reserve(2 * (L.encodedLength(iML) + pointR - pointL + 64));
+		INBIT<RUNN> W(pWork);
+		OUTBIT<RUNN> o(pWork);
+		o.encode(0, 0);
+		unsigned iT = o.getpos();
+		alu.shiftADD(o, iT, W, 0, L, iML, pointR - pointL);
+		alu.SUB(out, header(out, iOut, pointR), W, iT, R, iMR);
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * MUL, exact, the points add
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port left-hand-side
+	 * @param iL - location of left-hand-side
+	 * @param R - memory port right-hand-side
+	 * @param iR - location right-hand-side
+	 */
+	inline void MUL(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR) {
+		unsigned iML, iMR;
+		unsigned pointL = point(L, iL, iML), pointR = point(R, iR, iMR);
+
+		alu.MUL(out, header(out, iOut, pointL + pointR), L, iML, R, iMR);
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Shift right, keeps the fraction bits
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port of value
+	 * @param iL - location of value
+	 * @param {number} shift - shift count
+	 */
+	inline void LSR(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, unsigned shift) {
+		unsigned iML;
+		unsigned pointL = point(L, iL, iML);
+
+		copy(out, iOut, L, iML, pointL + shift);
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Shift left, uses up fraction bits before shifting the mantissa
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port of value
+	 * @param iL - location of value
+	 * @param {number} shift - shift count
+	 */
+	inline void LSL(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, unsigned shift) {
+		unsigned iML;
+		unsigned pointL = point(L, iL, iML);
+
+		if (pointL >= shift) {
+			copy(out, iOut, L, iML, pointL - shift);
+			return;
+		}
+
+		reserve(64);
+		INBIT<RUNN> W(pWork);
+		OUTBIT<RUNN> o(pWork);
+		o.encode(0, shift - pointL);
+		alu.LSL(out, header(out, iOut, 0), L, iML, W, 0);
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Largest integer not greater than the value
+	 *
+	 * @param out - memory port for result, an integer
+	 * @param iOut - location of result
+	 * @param L - memory port of value
+	 * @param iL - location of value
+	 */
+	inline void FLOOR(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL) {
+		unsigned iML;
+		unsigned pointL = point(L, iL, iML);
+
+		reserve(64);
+		INBIT<RUNN> W(pWork);
+		OUTBIT<RUNN> o(pWork);
+		o.encode(0, pointL);
+		alu.LSR(out, iOut, L, iML, W, 0);
+	}
+};
+
+/*
+ * @date 2026-10-16 22:35:51
+ *
+ * Division by a constant with the shift-add schedules of `div.c`, coefficients derived automatically.
+ *
+ * The divisor is split in `odd * 2^shift`.
+ * When the binary expansion of `1/odd` repeats every `period` bits, `1/odd = R / (2^period - 1)` with integer `R`, and
+ *   `x / odd = x * R * 2^-period * (1 + 2^-period) * (1 + 2^-2*period) * (1 + 2^-4*period) ...`
+ * The multiplication with `R` is a preamble of signed shifted copies of `x`, the product is a series of `n += n >> k`.
+ * For `3`, `6`, `9` and `15` this is the schedule of `div3()`, `div6()`, `div9()` and `div15()`.
+ * The number of steps grows with the logarithm of the length of the dividend.
+ *
+ * When the period is too long, `odd = 2^scale * P` with `1 <= P < 2`, and `P` is multiplied with factors `(1 +/- 2^-k)` until it is 1.
+ * Each factor eliminates the leading bit of the distance to 1, the sign of the distance selects `+` or `-`, as `div165()`.
+ *
+ * The dividend is shifted left by `guard` bits, the truncating shifts then cause an error below the final scaling, which rounds.
+ * The correction computes `r = x - q * d` and adjusts until `0 <= r < d`, then converts to truncation towards zero as C does.
+ *
+ * All steps are streaming `ALU` operations on encoded numbers, intermediates are stored in a private work memory.
+ * Results are copied out with the shortest encoding.
+ *
+ * In `fixed` mode, the default, the period schedule runs on `FIXALU` values and no step truncates:
+ * `n + (n >> k)` is the mantissa `m + (m << k)` with `k` more fraction bits, a single `shiftADD`.
+ * The only error is the tail of the product, a bias of `2^-(bitlength(odd)+1)` covers it and the floor is the quotient without correction.
+ * Division by zero returns `-1` as quotient and the dividend as remainder.
+ *
+ * @typedef {object} DIVCONST
+ */
+template<unsigned RUNN>
+struct DIVCONST {
+
+	enum {
+		MAXPERIOD = 256, // longest period of `1/odd` using the preamble
+	};
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Preamble term, `n += x << k` or `n -= x << k`
+	 */
+	struct TERM {
+		unsigned k;
+		bool negative;
+	};
+
+	int64_t divisor; // constant divisor
+	uint64_t odd;    // `|divisor|` without trailing zeros
+	unsigned shift;  // trailing zeros of `|divisor|`
+	unsigned period; // length of repeating binary expansion of `1/odd`, 0 when longer than `MAXPERIOD`
+
+	TERM terms[MAXPERIOD / 2 + 2]; // preamble, signed digits of multiplier
+	unsigned numTerms;             // number of `terms`
+	int *pSteps;                   // schedule, `+k` is `n += n >> k`, `-k` is `n -= n >> k`
+	unsigned numSteps;             // number of steps in `pSteps`
+	unsigned scale;                // final right shift, excluding `shift` and guard
+	unsigned precision;            // dividends up to this number of bits need no more than one correction
+
+	ALU<RUNN> alu;        // operators running the schedule
+	FIXALU<RUNN> fix;     // operators running the schedule in fixed mode
+	bool fixed;           // exact fixed-point schedule, no correction
+	unsigned char *pWork; // work memory of intermediates
+	unsigned workBits;    // allocated bits of `pWork`
+	unsigned iQuot;       // location of quotient in `pWork` after `divide()`
+	unsigned iRem;        // location of remainder in `pWork` after `divide()`
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Constructor/Initialise
+	 *
+	 * @param {int64_t} divisor - constant divisor
+	 */
+	inline DIVCONST(int64_t divisor) : divisor(divisor), numTerms(0), pSteps(NULL), numSteps(0), scale(0), precision(0), fixed(true), pWork(NULL), workBits(0), iQuot(0), iRem(0) {
+		uint64_t d = divisor < 0 ? -(uint64_t) divisor : divisor;
+
+		shift = d ? __builtin_ctzll(d) : 0;
+		odd = d >> shift;
+
+		// period is the order of 2 modulo `odd`
+		period = 0;
+		if (odd > 1) {
+			uint64_t p = 1;
+			do {
+				p = (p << 1) % odd;
+				period++;
+			} while (p != 1 && period <= MAXPERIOD);
+			if (p != 1)
+				period = 0;
+		}
+
+		generate(64);
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Release resources
+	 */
+	inline ~DIVCONST() {
+		free(pSteps);
+		free(pWork);
+	}
+
+	// the work memory is owned
+	DIVCONST(const DIVCONST &) = delete;
+	DIVCONST &operator=(const DIVCONST &) = delete;
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Append step to schedule
+	 */
+	inline void step(int k, unsigned &maxSteps) {
+		if (numSteps == maxSteps) {
+			maxSteps *= 2;
+			pSteps = (int *) realloc(pSteps, maxSteps * sizeof *pSteps);
+			if (!pSteps) {
+				fprintf(stderr, "out of memory\n");
+				exit(1);
+			}
+		}
+		pSteps[numSteps++] = k;
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Derive the schedule for dividends up to `bits` bits.
+	 * Stops when the relative error of the multiplier is below `2^-(bits+2)`, the error of the quotient is then below 1/4.
+	 *
+	 * @param {number} bits - precision
+	 */
+	void generate(unsigned bits) {
+		unsigned maxSteps = 16;
+
+		free(pSteps);
+		pSteps = (int *) malloc(maxSteps * sizeof *pSteps);
+		if (!pSteps) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		numSteps = 0;
+		numTerms = 0;
+		precision = bits;
+
+		if (period) {
+			// `R = (2^period - 1) / odd`, long division from the top limb
+			uint64_t R[MAXPERIOD / 64 + 1];
+			unsigned n = (period + 63) / 64;
+			uint64_t rem = 0;
+			for (unsigned i = n; i-- > 0;) {
+				unsigned width = i == n - 1 && (period & 63) ? period & 63 : 64;
+				uint64_t limb = width < 64 ? (1ULL << width) - 1 : ~0ULL;
+				unsigned __int128 cur = (unsigned __int128) rem << 64 | limb;
+				R[i] = cur / odd;
+				rem = cur % odd;
+			}
+			R[n] = 0;
+
+			// non-adjacent form of `R`, digits +1 and -1
+			for (unsigned k = 0; k <= period; k++) {
+				if (R[0] & 1) {
+					bool negative = (R[0] & 3) == 3;
+					terms[numTerms].k = k;
+					terms[numTerms].negative = negative;
+					numTerms++;
+
+					// remove digit
+					uint64_t one = 1;
+					if (negative)
+						BIGMUL::addto(R, n + 1, &one, 1);
+					else
+						BIGMUL::subfrom(R, n + 1, &one, 1);
+				}
+				for (unsigned i = 0; i <= n; i++)
+					R[i] = R[i] >> 1 | (i < n ? R[i + 1] << 63 : 0);
+			}
+
+			// `(1 + 2^-period) * (1 + 2^-2*period) ...`
+			for (unsigned k = period; k < bits + 2; k *= 2)
+				step(k, maxSteps);
+			scale = period;
+			return;
+		}
+
+		// single term preamble
+		terms[0].k = 0;
+		terms[0].negative = false;
+		numTerms = 1;
+		scale = odd ? 63 - __builtin_clzll(odd) : 0;
+
+		// `P = odd / 2^scale` as fixed-point with `F` fraction bits, `P` is below 2
+		unsigned F = bits + 8;
+		unsigned n = F / 64 + 2;
+		uint64_t *pP = (uint64_t *) calloc(3 * n, sizeof *pP);
+		if (!pP) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		uint64_t *pT = pP + n, *pDelta = pT + n;
+
+		unsigned lsb = F - scale;
+		if (odd) {
+			pP[lsb / 64] = odd << (lsb & 63);
+			if (lsb & 63)
+				pP[lsb / 64 + 1] = odd >> (64 - (lsb & 63));
+		}
+
+		while (odd) {
+			// `delta = |P - 1|`
+			uint64_t one = 1ULL << (F & 63);
+			memcpy(pDelta, pP, n * sizeof *pDelta);
+			BIGMUL::subfrom(pDelta + F / 64, n - F / 64, &one, 1);
+			bool negative = pDelta[n - 1] >> 63;
+			if (negative)
+				BIGMUL::neg(pDelta, n);
+
+			// leading bit of distance
+			unsigned top = n;
+			while (top && !pDelta[top - 1])
+				top--;
+			if (!top)
+				break; // exact
+			unsigned t = 64 * top - 1 - __builtin_clzll(pDelta[top - 1]);
+			if (t + bits + 2 < F)
+				break; // close enough
+
+			// factor `(1 +/- 2^-k)`, eliminating the leading bit
+			int k = F - t;
+
+			// `T = P >> k`
+			for (unsigned i = 0; i < n; i++) {
+				unsigned j = i + k / 64;
+				uint64_t lo = j < n ? pP[j] : 0, hi = j + 1 < n ? pP[j + 1] : 0;
+				pT[i] = k & 63 ? lo >> (k & 63) | hi << (64 - (k & 63)) : lo;
+			}
+
+			if (negative)
+				BIGMUL::add(pP, pP, pT, n);
+			else
+				BIGMUL::sub(pP, pP, pT, n);
+
+			step(negative ? k : -k, maxSteps);
+		}
+
+		free(pP);
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Sign of encoded value
+	 */
+	static inline bool negative(INBIT<RUNN> &port, unsigned pos) {
+		port.skip(pos);
+		return port.bit;
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Test for zero, results of the `ALU` may have long runs of leading zeros
+	 */
+	static inline bool zero(INBIT<RUNN> &port, unsigned pos) {
+		port.start(pos);
+		do {
+			port.nextbit();
+			if (port.bit)
+				return false;
+		} while (port.state);
+
+		return true;
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Copy value with the shortest encoding.
+	 * Each step of the schedule extends the encoding, the results are not passed on with the accumulated leading bits.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param port - memory port of value
+	 * @param pos - location of value
+	 */
+	static void compact(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &port, unsigned pos) {
+		bool polarity = negative(port, pos);
+
+		// data bits up to the last that differs from the polarity
+		unsigned length = 0;
+		port.start(pos);
+		for (unsigned i = 1; port.state; i++) {
+			port.nextbit();
+			if (port.bit != polarity)
+				length = i;
+		}
+
+		out.start(iOut);
+		port.start(pos);
+		for (unsigned i = 0; i < length; i++) {
+			port.nextbit();
+			out.emitbit(port.bit);
+		}
+		out.emitEOSS(polarity);
+		out.emitraw(polarity);
+		out.flush();
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Divide, leaving quotient at `iQuot` and remainder at `iRem` of `pWork`
+	 *
+	 * @param L - memory port of dividend
+	 * @param iL - location of dividend
+	 */
+	void divide(INBIT<RUNN> &L, unsigned iL) {
+		if (fixed && period) {
+			divideFixed(L, iL);
+			return;
+		}
+
+		// data bits are no more than raw bits, extend schedule when needed
+		unsigned length = L.encodedLength(iL);
+		if (length + 1 > precision)
+			generate(length + 1 > 2 * precision ? length + 1 : 2 * precision);
+
+		unsigned guard = 35 - __builtin_clz(numSteps | 1); // bitlength of `numSteps` + 3
+
+		// slots of intermediates, room for escapes of twice the data bits
+		// each streaming operation extends the encoding by a carry bit and a run of polarity
+		enum {
+			N0, N1, SHIFT, ONE, D, QUOT, REM, T, NUMSLOTS
+		};
+		unsigned growth = (RUNN + 1) * (numTerms + numSteps + 16);
+		unsigned slot = (2 * (length + guard + period + growth + 64) + 63) & ~63U;
+		if (NUMSLOTS * slot > workBits) {
+			workBits = NUMSLOTS * slot;
+			free(pWork);
+			pWork = (unsigned char *) calloc(workBits / 8 + 16, 1);
+			if (!pWork) {
+				fprintf(stderr, "out of memory\n");
+				exit(1);
+			}
+		}
+		INBIT<RUNN> W(pWork), V(pWork);
+		OUTBIT<RUNN> o(pWork);
+
+		unsigned iN = N0 * slot, iNext = N1 * slot, iShift = SHIFT * slot, iOne = ONE * slot, iD = D * slot, iT = T * slot;
+		iQuot = QUOT * slot;
+		iRem = REM * slot;
+
+		// `|divisor|`, also when it is `INT64_MIN`
+		o.encode(iOne, 1);
+		o.encode(iShift, shift);
+		o.encode(iT, odd);
+		alu.LSL(o, iD, W, iT, V, iShift);
+
+		if (!odd) {
+			// division by zero
+			o.encode(iQuot, -1);
+			alu.OR(o, iRem, L, iL, V, iT);
+			return;
+		}
+
+		// preamble, n = x * R << guard
+		o.encode(iN, 0);
+		for (unsigned i = 0; i < numTerms; i++) {
+			if (terms[i].negative)
+				alu.shiftSUB(o, iNext, W, iN, L, iL, terms[i].k + guard);
+			else
+				alu.shiftADD(o, iNext, W, iN, L, iL, terms[i].k + guard);
+
+			unsigned swap = iN;
+			iN = iNext;
+			iNext = swap;
+		}
+
+		// n = n +/- (n >> k)
+		for (unsigned i = 0; i < numSteps; i++) {
+			int k = pSteps[i];
+
+			o.encode(iShift, k < 0 ? -k : k);
+			alu.LSR(o, iT, W, iN, V, iShift);
+			if (k < 0)
+				alu.SUB(o, iNext, W, iN, V, iT);
+			else
+				alu.ADD(o, iNext, W, iN, V, iT);
+
+			unsigned swap = iN;
+			iN = iNext;
+			iNext = swap;
+		}
+
+		// round and scale
+		o.encode(iShift, guard + scale + shift - 1);
+		alu.LSR(o, iT, W, iN, V, iShift);
+		alu.ADD(o, iNext, W, iT, V, iOne);
+		alu.LSR(o, iQuot, W, iNext, V, iOne);
+
+		// r = x - q * d
+		alu.MUL(o, iT, W, iQuot, V, iD);
+		alu.SUB(o, iRem, L, iL, V, iT);
+
+		// floor division, `0 <= r < d`
+		while (negative(W, iRem)) {
+			alu.SUB(o, iT, W, iQuot, V, iOne);
+			alu.OR(o, iQuot, W, iT, V, iT);
+			alu.ADD(o, iT, W, iRem, V, iD);
+			alu.OR(o, iRem, W, iT, V, iT);
+		}
+		for (;;) {
+			alu.SUB(o, iT, W, iRem, V, iD);
+			if (negative(W, iT))
+				break;
+			alu.OR(o, iRem, W, iT, V, iT);
+			alu.ADD(o, iT, W, iQuot, V, iOne);
+			alu.OR(o, iQuot, W, iT, V, iT);
+		}
+
+		// truncation towards zero, remainder gets the sign of the dividend
+		if (negative(L, iL) && !zero(W, iRem)) {
+			alu.ADD(o, iT, W, iQuot, V, iOne);
+			alu.OR(o, iQuot, W, iT, V, iT);
+			alu.SUB(o, iT, W, iRem, V, iD);
+			alu.OR(o, iRem, W, iT, V, iT);
+		}
+
+		// negative divisor negates quotient
+		if (divisor < 0) {
+			o.encode(iT, 0);
+			alu.SUB(o, iNext, W, iT, V, iQuot);
+			alu.OR(o, iQuot, W, iNext, V, iNext);
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 23:58:36
+	 *
+	 * Divide with exact fixed-point steps, the period schedule only.
+	 * `t = |x| / odd` is approximated from below by `n = t * (1 - 2^-2K)` with `2K` the last step doubled.
+	 * With `2^2K >= 4 * |x|` the deficit is below `1/(4*odd)`, which is not more than the bias `b = 2^-(bitlength(odd)+1)`.
+	 * The fraction of `t` is a multiple of `1/odd` and `b` is below `1/(2*odd)`, `FLOOR(n + b)` equals `FLOOR(t)`.
+	 *
+	 * @param L - memory port of dividend
+	 * @param iL - location of dividend
+	 */
+	void divideFixed(INBIT<RUNN> &L, unsigned iL) {
+		// data bits are no more than raw bits, extend schedule when needed
+		unsigned length = L.encodedLength(iL);
+		if (length + 1 > precision)
+			generate(length + 1 > 2 * precision ? length + 1 : 2 * precision);
+
+		unsigned width = 64 - __builtin_clzll(odd); // bitlength of `odd`
+
+		fix.alu.native = alu.native;
+		fix.alu.limbs = alu.limbs;
+
+		// the mantissa is `|x| * R * (2^k1 + 1) * (2^k2 + 1) ...`
+		unsigned growth = period + (RUNN + 1) * (numTerms + 2 * numSteps + 16);
+		for (unsigned i = 0; i < numSteps; i++)
+			growth += pSteps[i] + 1;
+
+		enum {
+			N0, N1, X, D, QUOT, REM, T, NUMSLOTS
+		};
+		unsigned slot = (2 * (length + growth + 64) + 63) & ~63U;
+		if (NUMSLOTS * slot > workBits) {
+			workBits = NUMSLOTS * slot;
+			free(pWork);
+			pWork = (unsigned char *) calloc(workBits / 8 + 16, 1);
+			if (!pWork) {
+				fprintf(stderr, "out of memory\n");
+				exit(1);
+			}
+		}
+		INBIT<RUNN> W(pWork), V(pWork);
+		OUTBIT<RUNN> o(pWork);
+
+		unsigned iN = N0 * slot, iNext = N1 * slot, iX = X * slot, iD = D * slot, iT = T * slot;
+		iQuot = QUOT * slot;
+		iRem = REM * slot;
+
+		// |x|, negative dividends are negated in work memory
+		bool negL = negative(L, iL);
+		INBIT<RUNN> &A = negL ? V : L;
+		if (negL) {
+			o.encode(iT, 0);
+			alu.SUB(o, iX, W, iT, L, iL);
+		} else {
+			iX = iL;
+		}
+
+		// preamble, integer mantissa `|x| * R`, the last term writes the fixed-point value with `period` fraction bits
+		o.encode(iN, 0);
+		for (unsigned i = 0; i < numTerms; i++) {
+			unsigned iDst = i + 1 < numTerms ? iNext : FIXALU<RUNN>::header(o, iNext, period);
+			if (terms[i].negative)
+				alu.shiftSUB(o, iDst, W, iN, A, iX, terms[i].k);
+			else
+				alu.shiftADD(o, iDst, W, iN, A, iX, terms[i].k);
+
+			unsigned swap = iN;
+			iN = iNext;
+			iNext = swap;
+		}
+
+		// n = n + (n >> k), exact, the mantissa is `m + (m << k)` with `k` more fraction bits
+		for (unsigned i = 0; i < numSteps; i++) {
+			unsigned iM, k = pSteps[i];
+			unsigned point = FIXALU<RUNN>::point(W, iN, iM);
+			alu.shiftADD(o, FIXALU<RUNN>::header(o, iNext, point + k), W, iM, V, iM, k);
+
+			unsigned swap = iN;
+			iN = iNext;
+			iNext = swap;
+		}
+
+		// bias, then `FLOOR(n * 2^-shift)` in one pass
+		FIXALU<RUNN>::encode(o, iT, 1, width + 1);
+		fix.ADD(o, iNext, W, iN, V, iT);
+		unsigned iM;
+		o.encode(iT, FIXALU<RUNN>::point(W, iNext, iM) + shift);
+		alu.LSR(o, iQuot, W, iM, V, iT);
+
+		// sign of quotient
+		if (negL != (divisor < 0)) {
+			o.encode(iT, 0);
+			alu.SUB(o, iNext, W, iT, V, iQuot);
+			alu.OR(o, iQuot, W, iNext, V, iNext);
+		}
+
+		// r = x - q * d
+		o.encode(iD, divisor);
+		alu.MUL(o, iT, W, iQuot, V, iD);
+		alu.SUB(o, iRem, L, iL, V, iT);
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Native fast path, same as `ALU::fetch()`
+	 */
+	inline bool fetch(INBIT<RUNN> &L, unsigned iL, int64_t &lval) {
+		if (!alu.native || !L.fitsword(iL))
+			return false;
+
+		unsigned iEnd;
+		lval = kernel<RUNN>().decode(L.pBase, iL, &iEnd);
+		L.stop(iEnd, lval < 0);
+
+		// `INT64_MIN / -1` overflows
+		return divisor != -1 || lval != INT64_MIN;
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Quotient, truncated towards zero
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port dividend
+	 * @param iL - location of dividend
+	 */
+	inline void DIV(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL) {
+		int64_t lval;
+		if (fetch(L, iL, lval)) {
+			out.encode(iOut, divisor ? lval / divisor : -1);
+			return;
+		}
+
+		divide(L, iL);
+
+		// copy to output
+		INBIT<RUNN> W(pWork);
+		compact(out, iOut, W, iQuot);
+	}
+
+	/*
+	 * @date 2026-10-16 22:35:51
+	 *
+	 * Remainder, sign of dividend
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port dividend
+	 * @param iL - location of dividend
+	 */
+	inline void MOD(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL) {
+		int64_t lval;
+		if (fetch(L, iL, lval)) {
+			out.encode(iOut, divisor ? lval % divisor : lval);
+			return;
+		}
+
+		divide(L, iL);
+
+		// copy to output
+		INBIT<RUNN> W(pWork);
+		compact(out, iOut, W, iRem);
+	}
+};
+
+
+/*
+ * @date 2026-10-16 23:18:45
+ *
+ * Multiplication by a constant as a canonical-signed-digit shift-add/sub chain, the `n -= n >> k` technique of `div.c` turned around.
+ *
+ * The constant is recoded in non-adjacent form, `c = sum(d_i * 2^s_i)` with digits +1/-1 and no two adjacent.
+ * For example `10 = 8 + 2`, `1000 = 1024 - 32 + 8`, `3600 = 4096 - 512 + 16`.
+ * All terms `d_i * (x << s_i)` are summed in a single streaming pass, instead of an `ALU` pass per term:
+ * result bit `k` is the column sum of `d_i * x[k - s_i]` plus the carry, with a sliding window of the last `s_max+1` input bits.
+ * The highest digit of a 64-bit multiplier is at most `2^63`, the window is a single word.
+ *
+ * With `limbs` the input is read a chunk at a time and each chunk multiplied as a whole, the carry is the part above the chunk.
+ * Operands that fit a machine word take the `native` path.
+ *
+ * @typedef {object} MULC
+ */
+template<unsigned RUNN>
+struct MULC {
+
+	/*
+	 * @date 2026-10-16 23:18:45
+	 *
+	 * Term of chain, `+ (x << k)` or `- (x << k)`
+	 */
+	struct TERM {
+		unsigned k;
+		bool negative;
+	};
+
+	int64_t multiplier; // constant multiplier
+	uint64_t positive;  // bit `s` set for digit +1 at `2^s`
+	uint64_t negative;  // bit `s` set for digit -1 at `2^s`
+	TERM terms[32];     // non-zero digits, no two adjacent
+	unsigned numTerms;  // number of `terms`
+	unsigned top;       // position of the highest digit, the window is `top+1` bits
+
+	bool native; // same as `ALU::native`
+	bool limbs;  // same as `ALU::limbs`
+
+	/*
+	 * @date 2026-10-16 23:18:45
+	 *
+	 * Constructor/Initialise, recode the multiplier
+	 *
+	 * @param {int64_t} multiplier - constant multiplier
+	 */
+	inline MULC(int64_t multiplier) : multiplier(multiplier), positive(0), negative(0), numTerms(0), top(0), native(true), limbs(true) {
+		__int128 v = multiplier;
+
+		for (unsigned s = 0; v; s++) {
+			if (v & 1) {
+				// digit makes the remaining value a multiple of 4
+				bool minus = (v & 3) == 3;
+				if (minus)
+					negative |= 1ULL << s;
+				else
+					positive |= 1ULL << s;
+				v += minus ? 1 : -1;
+
+				terms[numTerms].k = s;
+				terms[numTerms].negative = minus;
+				numTerms++;
+				top = s;
+			}
+			v >>= 1;
+		}
+	}
+
+	/*
+	 * @date 2026-10-16 23:18:45
+	 *
+	 * Column sum of all terms
+	 *
+	 * @param {number} window - bit `s` is input bit `k-s`
+	 */
+	inline int column(uint64_t window) {
+		int sum = 0;
+		for (unsigned i = 0; i < numTerms; i++) {
+			int bit = window >> terms[i].k & 1;
+			sum += terms[i].negative ? -bit : bit;
+		}
+		return sum;
+	}
+
+	/*
+	 * @date 2026-10-16 23:18:45
+	 *
+	 * Multiply chunks, the multiplier is applied to a whole chunk of input, the carry is everything above it.
+	 * Same result as the bit-serial window.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port of multiplicand
+	 * @param iL - location of multiplicand
+	 */
+	inline void limbMUL(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL) {
+		enum {
+			CHUNK = INCHUNK<RUNN>::CHUNK,
+		};
+		static constexpr uint64_t MASK = (1ULL << CHUNK) - 1;
+
+		// start engines
+		void (*refill)(INCHUNK<RUNN> &chunk, const unsigned char *pBase) = kernel<RUNN>().refill;
+		INCHUNK<RUNN> l;
+		out.start(iOut);
+		l.start(iL);
+
+		__int128 carry = 0;
+		unsigned done = 0; // data bits emitted
+
+		for (;;) {
+			// load next chunk of input pipeline
+			refill(l, L.pBase);
+
+			__int128 sum = (__int128) (l.peek() & MASK) * multiplier + carry;
+			carry = sum >> CHUNK;
+
+			// the product has no more than `top+1` data bits more than the multiplicand, see `MUL()`
+			// `total` includes the marker, the product may already be complete
+			if (l.row & DECODEBYTE::EOS) {
+				unsigned length = l.total + top + 2 - RUNN;
+				unsigned last = length > done ? length - done : 0;
+
+				if (last < CHUNK) {
+					bool polarity = (sum >> last) & 1;
+
+					// emit operator result, end-of-sequence marker and finalise
+					out.emitdata((uint64_t) sum & MASK, last);
+					out.emitEOSS(polarity);
+					out.emitraw(polarity);
+					break;
+				}
+			}
+
+			// emit operator result
+			out.emitdata((uint64_t) sum & MASK, CHUNK);
+			l.consume(CHUNK);
+			done += CHUNK;
+		}
+
+		// write to memory
+		out.flush();
+
+		// leave port as the bit-serial loop does
+		l.stop(L);
+	}
+
+	/*
+	 * @date 2026-10-16 23:18:45
+	 *
+	 * Streaming multiply by the constant
+	 *
+	 * At least the last `RUNN-1` data bits of the multiplicand equal its polarity, it fits `nL-RUNN+2` bits.
+	 * `|multiplier| < 2^(top+1)`, the product fits `nL-RUNN+top+3` bits, the last being the polarity.
+	 *
+	 * @param out - memory port for result
+	 * @param iOut - location of result
+	 * @param L - memory port of multiplicand
+	 * @param iL - location of multiplicand
+	 */
+	inline void MUL(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL) {
+
+		int64_t num;
+		if (native && L.fitsword(iL)) {
+			unsigned iEnd;
+			int64_t lval = kernel<RUNN>().decode(L.pBase, iL, &iEnd);
+			L.stop(iEnd, lval < 0);
+
+			if (!__builtin_mul_overflow(lval, multiplier, &num)) {
+				out.encode(iOut, num);
+				return;
+			}
+		}
+
+		if (limbs) {
+			limbMUL(out, iOut, L, iL);
+			return;
+		}
+
+		// start engines
+		out.start(iOut);
+		L.start(iL);
+
+		uint64_t window = 0; // bit `s` is input bit `k-s`
+		int carry = 0;
+		unsigned k = 0;
+		unsigned nL = 0; // number of data bits
+
+		do {
+			// load next data bit of input pipeline
+			L.nextbit();
+			if (L.state)
+				nL = k + 1;
+			window = window << 1 | L.bit;
+
+			// column sum of all terms
+			int sum = carry + column(window);
+			carry = sum >> 1;
+
+			// emit operator result
+			out.emitbit(sum & 1);
+			k++;
+		} while (L.state || k + RUNN < nL + top + 2);
+
+		// operator on final polarity
+		window = window << 1 | L.bit;
+		bool polarity = (carry + column(window)) & 1;
+
+		// end-of-sequence marker
+		out.emitEOSS(polarity);
+
+		// finalise end-of-sequence
+		out.emitraw(polarity);
+
+		// write to memory
+		out.flush();
+	}
+};
+
+/*
+ * @date 2020-07-08 00:33:53
+ *
+ * Signal handler for timer tick
+ */
+void sigAlarm(int sig) {
+	tick++;
+	alarm(1);
+}
+
+/*
+ * @date 2026-10-16 16:55:21
+ *
+ * Quasi random numbers for tests
+ */
+uint64_t xorshift64(void) {
+	static uint64_t x = 0x9e3779b97f4a7c15ULL;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	return x;
+}
+
+/*
+ * @date 2026-10-16 16:55:21
+ *
+ * Compare two raw bit sequences
+ */
+bool rawequal(unsigned char *pL, unsigned iL, unsigned char *pR, unsigned iR, unsigned length) {
+	while (length--) {
+		if (((pL[iL >> 3] >> (iL & 7)) & 1) != ((pR[iR >> 3] >> (iR & 7)) & 1))
+			return false;
+		iL++;
+		iR++;
+	}
+	return true;
+}
+
+/*
+ * @date 2026-10-16 21:08:33
+ *
+ * Compare two values of any length, their encodings may differ
+ */
+template<unsigned RUNN>
+bool valueequal(unsigned char *pL, unsigned iL, unsigned char *pR, unsigned iR) {
+	INBIT<RUNN> L(pL), R(pR);
+
+	L.start(iL);
+	R.start(iR);
+	do {
+		L.nextbit();
+		R.nextbit();
+		if (L.bit != R.bit)
+			return false;
+	} while (L.state || R.state);
+
+	return true;
+}
+
+/*
+ * @date 2026-10-17 00:19:47
+ *
+ * Exhaustive verification of the signed operators, all operand pairs from `-(1<<bits)` to `+(1<<bits)` on concurrent threads.
+ *
+ * Operands are encoded once into a shared read-only table.
+ * Each worker has its own result memory, ports and `ALU`, there is no shared mutable state other than the ranges and counters.
+ * The rows of left-hand operands are split in equal ranges, one per worker.
+ * A worker takes rows from the front of its range, when empty it steals the upper half of the largest remaining range.
+ * A range is a packed `next`/`end` pair, updated with compare-and-swap.
+ *
+ * @typedef {object} VERIFIER
+ */
+template<unsigned RUNN>
+struct VERIFIER {
+
+	/*
+	 * @date 2026-10-17 00:19:47
+	 *
+	 * Worker state
+	 */
+	struct WORKER {
+		VERIFIER *pVerifier;
+		uint64_t range;         // rows `next` (low 32 bits) up to `end` (high 32 bits)
+		unsigned char mem[512]; // result memory
+		uint64_t pairs;         // operand pairs verified
+	};
+
+	unsigned bits;        // operands range from `-(1<<bits)` to `+(1<<bits)`
+	unsigned numValues;   // number of operands, `2^(bits+1) + 1`
+	unsigned char *pTable; // encoded operands
+	unsigned *pPos;       // location of each operand in `pTable`
+	unsigned opcode;      // operator being verified, numbered as in `selftest()`
+	WORKER *pWorkers;     // one per thread
+	unsigned numWorkers;  // number of workers
+	unsigned rowsDone;    // progress, shared
+	int failed;           // set by first worker to find an error, stops all
+
+	/*
+	 * @date 2026-10-17 00:19:47
+	 *
+	 * Constructor/Initialise, encode operand table
+	 *
+	 * @param {number} bits - operand range
+	 * @param {number} numThreads - number of workers
+	 */
+	VERIFIER(unsigned bits, unsigned numThreads) : bits(bits), opcode(0), numWorkers(numThreads ? numThreads : 1), rowsDone(0), failed(0) {
+		numValues = (2U << bits) + 1;
+
+		// room for escapes of twice the data bits
+		pTable = (unsigned char *) calloc((uint64_t) numValues * (2 * bits + 64) / 8 + 16, 1);
+		pPos = (unsigned *) malloc(numValues * sizeof *pPos);
+		pWorkers = (WORKER *) calloc(numWorkers, sizeof *pWorkers);
+		if (!pTable || !pPos || !pWorkers) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+
+		OUTBIT<RUNN> ob(pTable);
+		unsigned pos = 0;
+		for (unsigned i = 0; i < numValues; i++) {
+			pPos[i] = pos;
+			ob.encode(pos, value(i));
+			pos = ob.getpos();
+		}
+	}
+
+	/*
+	 * @date 2026-10-17 00:19:47
+	 *
+	 * Release resources
+	 */
+	~VERIFIER() {
+		free(pTable);
+		free(pPos);
+		free(pWorkers);
+	}
+
+	// the table is owned
+	VERIFIER(const VERIFIER &) = delete;
+	VERIFIER &operator=(const VERIFIER &) = delete;
+
+	/*
+	 * @date 2026-10-17 00:19:47
+	 *
+	 * Operand of row or column `i`
+	 */
+	inline int64_t value(unsigned i) {
+		return (int64_t) i - (1 << bits);
+	}
+
+	/*
+	 * @date 2026-10-17 00:19:47
+	 *
+	 * Take next row of own range
+	 *
+	 * @return {boolean} - false when range is empty
+	 */
+	static bool take(WORKER &w, unsigned &row) {
+		uint64_t range = __atomic_load_n(&w.range, __ATOMIC_ACQUIRE);
+		for (;;) {
+			unsigned next = range, end = range >> 32;
+			if (next >= end)
+				return false;
+			if (__atomic_compare_exchange_n(&w.range, &range, (uint64_t) end << 32 | (next + 1), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+				row = next;
+				return true;
+			}
+		}
+	}
 
 	/*
-	 * @date 2020-07-08 18:56:29
+	 * @date 2026-10-17 00:19:47
 	 *
-	 * Streaming ADD
+	 * Steal the upper half of the largest remaining range into the empty range of `w`
 	 *
-	 * @param out - memory port for result
-	 * @param iOut - location of result
-	 * @param L - memory port left-hand-side
-	 * @param iL - location of left-hand-side
-	 * @param R - memory port right-hand-side
-	 * @param iR - location right-hand-side
+	 * @return {boolean} - false when no work is left
 	 */
-	inline void ADD(OUTBIT &out, unsigned iOut, INBIT &L, unsigned iL, INBIT &R, unsigned iR) {
+	bool steal(WORKER &w) {
+		for (;;) {
+			// victim with most rows left
+			WORKER *pVictim = NULL;
+			uint64_t range = 0;
+			unsigned most = 0;
+			for (unsigned i = 0; i < numWorkers; i++) {
+				uint64_t r = __atomic_load_n(&pWorkers[i].range, __ATOMIC_ACQUIRE);
+				unsigned next = r, end = r >> 32;
+				if (next < end && end - next > most) {
+					pVictim = &pWorkers[i];
+					range = r;
+					most = end - next;
+				}
+			}
+			if (!pVictim)
+				return false;
+
+			// a single row is left to its owner
+			unsigned next = range, end = range >> 32;
+			unsigned mid = next + most / 2;
+			if (mid == next)
+				return false;
+
+			if (__atomic_compare_exchange_n(&pVictim->range, &range, (uint64_t) mid << 32 | next, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+				__atomic_store_n(&w.range, (uint64_t) end << 32 | mid, __ATOMIC_RELEASE);
+				return true;
+			}
+		}
+	}
 
-		// start engines
-		out.start(iOut);
-		L.start(iL);
-		R.start(iR);
+	/*
+	 * @date 2026-10-17 00:19:47
+	 *
+	 * Verify operator for all right-hand operands of row
+	 *
+	 * @return {number} - 0 on success
+	 */
+	int row(WORKER &w, ALU<RUNN> &alu, unsigned row) {
+		INBIT<RUNN> L(pTable), R(pTable), ib(w.mem);
+		OUTBIT<RUNN> ob(w.mem);
+
+		int64_t lval = value(row);
+		unsigned iL = pPos[row];
+
+		for (unsigned column = 0; column < numValues; column++) {
+			int64_t rval = value(column);
+			unsigned iR = pPos[column];
+
+			// alternate between native fast path, limbs and bit-serial, rotating per row so every mode sees every operand
+			alu.native = (row + column) & 1;
+			alu.limbs = (row + column) & 2;
+
+			int64_t expected = 0;
+			switch (opcode) {
+			case 0:
+				alu.MUL(ob, 0, L, iL, R, iR);
+				expected = lval * rval;
+				break;
+			case 1:
+				alu.DIV(ob, 0, L, iL, R, iR);
+				expected = rval ? lval / rval : -1;
+				break;
+			case 2:
+				alu.MOD(ob, 0, L, iL, R, iR);
+				expected = rval ? lval % rval : lval;
+				break;
+			case 3:
+				alu.ADD(ob, 0, L, iL, R, iR);
+				expected = lval + rval;
+				break;
+			case 4:
+				alu.SUB(ob, 0, L, iL, R, iR);
+				expected = lval - rval;
+				break;
+			case 5:
+				if (rval < 0 || rval > 20)
+					continue; // limit range
+				alu.LSL(ob, 0, L, iL, R, iR);
+				expected = lval << rval;
+				break;
+			case 6:
+				if (rval < 0 || rval > 20)
+					continue; // limit range
+				alu.LSR(ob, 0, L, iL, R, iR);
+				expected = lval >> rval;
+				break;
+			case 7:
+				alu.AND(ob, 0, L, iL, R, iR);
+				expected = lval & rval;
+				break;
+			case 8:
+				alu.XOR(ob, 0, L, iL, R, iR);
+				expected = lval ^ rval;
+				break;
+			case 9:
+				alu.OR(ob, 0, L, iL, R, iR);
+				expected = lval | rval;
+				break;
+			}
 
-		bool ebit = 0;
-		bool carry = 0;
+			int64_t answer = ib.decode(0);
+			if (answer != expected) {
+				fprintf(stderr, "\r\e[Kresult error 0x%lx OPCODE%u 0x%lx. Expected=0x%lx Encountered 0x%lx\n", lval, opcode, rval, expected, answer);
+				return 1;
+			}
+			w.pairs++;
+		}
+
+		return 0;
+	}
+
+	/*
+	 * @date 2026-10-17 00:19:47
+	 *
+	 * Thread entrypoint, the first worker displays progress
+	 */
+	static void *worker(void *arg) {
+		WORKER &w = *(WORKER *) arg;
+		VERIFIER &v = *w.pVerifier;
+		ALU<RUNN> alu;
+
+		for (;;) {
+			unsigned row;
+			while (take(w, row)) {
+				if (__atomic_load_n(&v.failed, __ATOMIC_RELAXED))
+					return NULL;
+
+				if (v.row(w, alu, row)) {
+					__atomic_store_n(&v.failed, 1, __ATOMIC_RELAXED);
+					return NULL;
+				}
+
+				unsigned done = __atomic_add_fetch(&v.rowsDone, 1, __ATOMIC_RELAXED);
+				if (&w == v.pWorkers && tick) {
+					fprintf(stderr, "\r\e[K%.2f%%", done * 100.0 / v.numValues);
+					tick = 0;
+				}
+			}
+			if (!v.steal(w))
+				return NULL;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 00:19:47
+	 *
+	 * Verify all operators
+	 *
+	 * @return {number} - 0 on success
+	 */
+	int run() {
+		pthread_t *pThreads = (pthread_t *) calloc(numWorkers, sizeof *pThreads);
+		if (!pThreads) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+
+		for (opcode = 0; opcode < 10 && !failed; opcode++) {
+			// display round
+			// @formatter:off
+			switch (opcode) {
+			case 0: fputs("MUL\n", stdout); break;
+			case 1: fputs("DIV\n", stdout); break;
+			case 2: fputs("MOD\n", stdout); break;
+			case 3: fputs("ADD\n", stdout); break;
+			case 4: fputs("SUB\n", stdout); break;
+			case 5: fputs("LSL\n", stdout); break;
+			case 6: fputs("LSR\n", stdout); break;
+			case 7: fputs("AND\n", stdout); break;
+			case 8: fputs("XOR\n", stdout); break;
+			case 9: fputs("OR\n", stdout); break;
+			}
+			// @formatter:on
+
+			// equal ranges of rows
+			rowsDone = 0;
+			for (unsigned i = 0; i < numWorkers; i++) {
+				uint64_t next = (uint64_t) numValues * i / numWorkers, end = (uint64_t) numValues * (i + 1) / numWorkers;
+				pWorkers[i].pVerifier = this;
+				pWorkers[i].range = end << 32 | next;
+			}
+
+			// first worker on calling thread
+			for (unsigned i = 1; i < numWorkers; i++) {
+				if (pthread_create(&pThreads[i], NULL, worker, &pWorkers[i]) != 0) {
+					fprintf(stderr, "pthread_create() failed\n");
+					exit(1);
+				}
+			}
+			worker(&pWorkers[0]);
+			for (unsigned i = 1; i < numWorkers; i++)
+				pthread_join(pThreads[i], NULL);
+
+			fprintf(stderr, "\r\e[K");
+		}
+
+		free(pThreads);
+		return failed;
+	}
+};
+
+/*
+ * @date 2026-10-16 18:25:31
+ *
+ * Test engine for runlength `RUNN`
+ *
+ * @param {number} aluBits - operands of the ALU tests range from -(1<<aluBits) to +(1<<aluBits)
+ * @param {number} numThreads - number of threads for the exhaustive operator test
+ * @return {number} - 0 on success
+ */
+template<unsigned RUNN>
+int selftest(unsigned aluBits, unsigned numThreads) {
+	printf("RUNN=%u\n", RUNN);
+
+	unsigned char mem[512] = {}; // test memory, zeroed like the former global
+	unsigned pos;           // next free bit of `mem`
+
+	INBIT<RUNN> ib(mem), L(mem), R(mem);
+	OUTBIT<RUNN> ob(mem);
+
+	/*
+	 * Display numbers for visual inspection
+	 */
+	if (0) {
+		for (int64_t num = -128; num <= +128; num++) {
+			// rewind memory
+			pos = 0;
+
+			// encode test value
+			ob.encode(pos, num);
+			pos = ob.getpos();
+
+			printf("%3d: ", (int) num);
+
+			// display encoded answer
+			ib.start(0);
+			unsigned k;
+			for (k = 0; k < pos; k++)
+				putchar(ib.nextraw() ? '1' : '0');
+
+			// decode value
+			int64_t n;
+			n = ib.decode(0);
+			printf(" [%ld]", n);
+
+			putchar('\n');
+		}
+	}
+
+	/*
+	 * Test that `encode/decode` counter each other.
+	 */
+	for (int64_t num = -(1 << 13); num <= +(1 << 13); num++) {
+		// rewind memory, vary alignment of first bit
+		pos = num & 7;
+
+		// encode test value
+		ob.encode(pos, num);
+		pos = ob.getpos();
+
+		// decode value
+		int64_t n;
+		n = ib.decode(num & 7);
+
+		if (n != num || ib.getpos() != pos) {
+			fprintf(stderr, "encode/decode error. Expected=%ld Encountered=%ld\n", num, n);
+			return 1;
+		}
+
+		// bit-serial decoder must agree
+		n = ib.decodeSerial(num & 7);
+
+		if (n != num || ib.getpos() != pos) {
+			fprintf(stderr, "encode/decodeSerial error. Expected=%ld Encountered=%ld\n", num, n);
+			return 1;
+		}
+
+		// bit-serial encoder must produce identical bits
+		ob.encodeSerial(2048, num);
+		if (ob.getpos() - 2048 != pos - (num & 7) || !rawequal(mem, num & 7, mem, 2048, pos - (num & 7))) {
+			fprintf(stderr, "encode/encodeSerial error. num=%ld\n", num);
+			return 1;
+		}
+	}
+
+	/*
+	 * Test full-width values, word-at-a-time against bit-serial
+	 */
+	for (unsigned i = 0; i < (1 << 20); i++) {
+		int64_t num = xorshift64();
+		// vary the width
+		num >>= num & 63;
+
+		ob.encode(i & 7, num);
+		pos = ob.getpos();
+		ob.encodeSerial(2048, num);
+
+		if (ob.getpos() - 2048 != pos - (i & 7) || !rawequal(mem, i & 7, mem, 2048, pos - (i & 7))) {
+			fprintf(stderr, "encode/encodeSerial error. num=%ld\n", num);
+			return 1;
+		}
+
+		if (OUTBIT<RUNN>::length(num) != pos - (i & 7)) {
+			fprintf(stderr, "length error. num=%ld Expected=%u Encountered=%u\n", num, pos - (i & 7), OUTBIT<RUNN>::length(num));
+			return 1;
+		}
+
+		// NOTE: `decodeSerial()` needs data bits and end-of-sequence buildup to fit in 64 bits
+		int64_t n = ib.decode(i & 7);
+		if (n != num || ib.getpos() != pos || (__builtin_clrsbll(num) > RUNN && ib.decodeSerial(2048) != num)) {
+			fprintf(stderr, "encode/decode error. Expected=%ld Encountered=%ld\n", num, n);
+			return 1;
+		}
+	}
+
+#if defined(__x86_64__)
+	/*
+	 * Test BMI2 decode kernel against `INBIT::decode()`
+	 */
+	if (__builtin_cpu_supports("bmi2")) {
+		INPEXT<RUNN> px(mem);
+
+		for (int64_t num = -(1 << 13); num <= +(1 << 13); num++) {
+			ob.encode(num & 7, num);
+			pos = ob.getpos();
+
+			int64_t n = px.decode(num & 7);
+			if (n != num || px.getpos() != pos) {
+				fprintf(stderr, "INPEXT::decode error. Expected=%ld Encountered=%ld\n", num, n);
+				return 1;
+			}
+		}
+
+		for (unsigned i = 0; i < (1 << 20); i++) {
+			int64_t num = xorshift64();
+			// vary the width
+			num >>= num & 63;
+
+			ob.encode(i & 7, num);
+			pos = ob.getpos();
+
+			int64_t n = px.decode(i & 7);
+			if (n != num || px.getpos() != pos) {
+				fprintf(stderr, "INPEXT::decode error. Expected=%ld Encountered=%ld\n", num, n);
+				return 1;
+			}
+		}
+
+		// quasi random memory
+		for (unsigned i = 0; i < (1 << 20); i++) {
+			for (unsigned k = 0; k < 64; k += 8) {
+				uint64_t r = xorshift64();
+				memcpy(mem + k, &r, sizeof r);
+			}
+
+			unsigned start = i & 255;
+			int64_t n = px.decode(start);
+			if (n != ib.decode(start) || px.getpos() != ib.getpos()) {
+				fprintf(stderr, "INPEXT::decode error. start=%u Expected=%ld Encountered=%ld\n", start, ib.decode(start), n);
+				return 1;
+			}
+		}
+	}
+
+	/*
+	 * Test AVX2 batch decoder against `INBIT::decode()` on quasi random memory, decoding all start positions at once
+	 */
+	if (__builtin_cpu_supports("avx2")) {
+		INGATHER<RUNN> gx(mem);
+		unsigned starts[256], ends[256];
+		int64_t nums[256];
+
+		for (unsigned i = 0; i < 256; i++)
+			starts[i] = i;
+
+		for (unsigned i = 0; i < (1 << 12); i++) {
+			for (unsigned k = 0; k < 64; k += 8) {
+				uint64_t r = xorshift64();
+				memcpy(mem + k, &r, sizeof r);
+			}
+
+			gx.decode(starts, 256, nums, ends);
+			for (unsigned k = 0; k < 256; k++) {
+				if (nums[k] != ib.decode(k) || ends[k] != ib.getpos()) {
+					fprintf(stderr, "INGATHER::decode error. start=%u Expected=%ld Encountered=%ld\n", k, ib.decode(k), nums[k]);
+					return 1;
+				}
+			}
+		}
+	}
+#endif
+
+	/*
+	 * Test `skip()` against `decode()`
+	 */
+	for (unsigned i = 0; i < (1 << 18); i++) {
+		for (unsigned k = 0; k < 64; k += 8) {
+			uint64_t r = xorshift64();
+			memcpy(mem + k, &r, sizeof r);
+		}
+
+		unsigned start = i & 255;
+		ib.decode(start);
+		if (L.skip(start) != ib.getpos() || L.getpos() != ib.getpos() || L.bit != ib.bit || L.encodedLength(start) != ib.getpos() - start) {
+			fprintf(stderr, "skip error. start=%u Expected=%u Encountered=%u\n", start, ib.getpos(), L.getpos());
+			return 1;
+		}
+	}
+
+	// seek element of concatenated values
+	for (unsigned i = 0; i < (1 << 12); i++) {
+		unsigned iElement[64];
+
+		ob.start(i & 7);
+		for (unsigned k = 0; k < 64; k++) {
+			int64_t num = xorshift64();
+			num >>= 32 + (num & 31);
+
+			iElement[k] = ob.getpos();
+			ob.encode(iElement[k], num);
+		}
+
+		pos = i & 7;
+		for (unsigned k = 0; k < 64; k++) {
+			if (pos != iElement[k]) {
+				fprintf(stderr, "skip error. element=%u Expected=%u Encountered=%u\n", k, iElement[k], pos);
+				return 1;
+			}
+			pos = ib.skip(pos);
+		}
+	}
+
+	/*
+	 * Test `encodeBatch()` against `encode()`
+	 */
+	{
+		enum { numValues = 256 };
+		int64_t values[numValues];
+		unsigned offsets[numValues];
+		unsigned char *pBatch = (unsigned char *) calloc(numValues * 16 + 64, 1);
+		unsigned char *pSingle = (unsigned char *) calloc(numValues * 16 + 64, 1);
+		OUTBIT<RUNN> bob(pBatch), sob(pSingle);
+
+		for (unsigned round = 0; round < 1024; round++) {
+			for (unsigned k = 0; k < numValues; k++) {
+				values[k] = xorshift64();
+				values[k] >>= values[k] & 63;
+			}
+
+			unsigned n = round % numValues;
+			unsigned end = bob.encodeBatch(round & 7, values, n, offsets);
+
+			pos = round & 7;
+			for (unsigned k = 0; k < n; k++) {
+				if (offsets[k] != pos) {
+					fprintf(stderr, "encodeBatch offset error. element=%u Expected=%u Encountered=%u\n", k, pos, offsets[k]);
+					return 1;
+				}
+				sob.encode(pos, values[k]);
+				pos = sob.getpos();
+			}
+
+			if (end != pos || end - (round & 7) != OUTBIT<RUNN>::lengthBatch(values, n) || !rawequal(pBatch, round & 7, pSingle, round & 7, end - (round & 7))) {
+				fprintf(stderr, "encodeBatch error. round=%u\n", round);
+				return 1;
+			}
+
+			// without offsets, preserving bits around the stream
+			unsigned char before = 0x55 & ((1 << (round & 7)) - 1);
+			pBatch[0] = 0x55;
+			pBatch[end / 8 + 1] = 0xaa;
+			if (bob.encodeBatch(round & 7, values, n, NULL) != end
+				|| (pBatch[0] & ((1 << (round & 7)) - 1)) != before || pBatch[end / 8 + 1] != 0xaa
+				|| !rawequal(pBatch, round & 7, pSingle, round & 7, end - (round & 7))) {
+				fprintf(stderr, "encodeBatch error. round=%u\n", round);
+				return 1;
+			}
+		}
+
+		free(pSingle);
+		free(pBatch);
+	}
+
+	/*
+	 * Test boundary scanner against the positions returned by `encode()`
+	 * Include many zero values, they form long runs with multiple end-of-sequence markers
+	 */
+	{
+		enum { bufSize = 1 << 16 };
+		unsigned char *pBuf = (unsigned char *) calloc(bufSize + 64, 1);
+		uint64_t *pExpected = (uint64_t *) malloc(bufSize * 8 * sizeof *pExpected);
+		OUTBIT<RUNN> sob(pBuf);
+
+		for (unsigned round = 0; round < 16; round++) {
+			uint64_t numExpected = 0;
+
+			pos = 0;
+			while (pos < (bufSize - 32) * 8) {
+				int64_t num = xorshift64();
+				switch (num & 3) {
+				case 0: num = 0; break;
+				case 1: num = -1; break;
+				case 2: num >>= 58; break;
+				default: num >>= num & 63; break;
+				}
+
+				sob.encode(pos, num);
+				pos = sob.getpos();
+				pExpected[numExpected++] = pos;
+			}
+
+			for (unsigned numThreads = 1; numThreads <= 7; numThreads += 2) {
+				for (unsigned simd = 0; simd < 2; simd++) {
+					BOUNDARY<RUNN> scanner(pBuf, pos);
+					scanner.simd = scanner.simd && simd;
+
+					uint64_t count;
+					uint64_t *pEnds = scanner.scanAll(numThreads, &count);
+
+					if (count != numExpected || memcmp(pEnds, pExpected, count * sizeof *pEnds) != 0) {
+						fprintf(stderr, "boundary scan error. threads=%u simd=%u Expected=%lu Encountered=%lu\n", numThreads, simd, numExpected, count);
+						return 1;
+					}
+					free(pEnds);
+				}
+			}
+		}
+
+		free(pExpected);
+		free(pBuf);
+	}
+
+	/*
+	 * Test all kernels supported by the CPU against the bit-serial reference
+	 */
+	unsigned startup = kernelIndex;
+
+	for (unsigned k = 0; k < numKernels; k++) {
+		if (!kernelSelect(kernels[k].name))
+			continue; // not supported
+
+		for (int64_t num = -(1 << 13); num <= +(1 << 13); num++) {
+			pos = kernel<RUNN>().encode(mem, num & 7, num);
+			unsigned end = serialEncode<RUNN>(mem, 2048, num);
+
+			if (end - 2048 != pos - (num & 7) || !rawequal(mem, num & 7, mem, 2048, pos - (num & 7))) {
+				fprintf(stderr, "kernel %s encode error. num=%ld\n", kernels[kernelIndex].name, num);
+				return 1;
+			}
+
+			int64_t n = kernel<RUNN>().decode(mem, num & 7, &end);
+			if (n != num || end != pos) {
+				fprintf(stderr, "kernel %s decode error. Expected=%ld Encountered=%ld\n", kernels[kernelIndex].name, num, n);
+				return 1;
+			}
+		}
+
+		// batch decode of values at scattered positions, including queues shorter than the number of lanes
+		enum { numValues = 1024 };
+		static int64_t values[numValues], decoded[numValues];
+		static unsigned offsets[numValues], ends[numValues], scattered[numValues], positions[numValues];
+		unsigned char *pBuf = (unsigned char *) calloc(numValues * 16 + 64, 1);
+		OUTBIT<RUNN> bob(pBuf);
+
+		for (unsigned round = 0; round < 64; round++) {
+			// NOTE: widths within reach of `decodeSerial()`
+			for (unsigned i = 0; i < numValues; i++) {
+				values[i] = xorshift64();
+				values[i] >>= 8 + (values[i] & 63) % 56;
+			}
+			bob.encodeBatch(round & 7, values, numValues, offsets);
+
+			// quasi random order
+			unsigned n = round < 16 ? round : (unsigned) numValues;
+			for (unsigned i = 0; i < n; i++)
+				scattered[i] = (i * 389 + round) % numValues;
+			for (unsigned i = 0; i < n; i++)
+				positions[i] = offsets[scattered[i]];
+
+			kernel<RUNN>().decodeBatch(pBuf, positions, n, decoded, ends);
+			for (unsigned i = 0; i < n; i++) {
+				unsigned end;
+				int64_t expected = kernel<RUNN>().decode(pBuf, positions[i], &end);
+
+				if (decoded[i] != expected || decoded[i] != values[scattered[i]] || ends[i] != end) {
+					fprintf(stderr, "kernel %s decodeBatch error. Expected=%ld Encountered=%ld\n", kernels[kernelIndex].name, expected, decoded[i]);
+					return 1;
+				}
+			}
+
+			// without end positions
+			kernel<RUNN>().decodeBatch(pBuf, positions, n, decoded, NULL);
+			for (unsigned i = 0; i < n; i++) {
+				if (decoded[i] != values[scattered[i]]) {
+					fprintf(stderr, "kernel %s decodeBatch error. Expected=%ld Encountered=%ld\n", kernels[kernelIndex].name, values[scattered[i]], decoded[i]);
+					return 1;
+				}
+			}
+		}
+
+		free(pBuf);
+	}
+
+	// restore startup selection
+	kernelIndex = startup;
+
+	/*
+	 * Test that the encoded value has smallest storage.
+	 * This is done by filling memory with quasi random bits, decoding+encoding, testing the size of representation being less-equal to the original
+	 */
+	for (int polarity = 0; polarity < 2; polarity++) {
+		for (int64_t num = 0x0000; num <= 0xffff; num++) {
+			// setup memory
+			mem[0] = num;
+			mem[1] = (num >> 8);
+			if (polarity)
+				mem[2] = mem[3] = 0xff;
+			else
+				mem[2] = mem[3] = 0x00;
 
-		do {
-			// load next data bit of input pipelines
-			L.nextbit();
-			R.nextbit();
+			// which bit is not part of the leading polarity
+			int lengthDecode = 0;
+			for (lengthDecode = 31; lengthDecode >= 0; --lengthDecode) {
+				if (((mem[lengthDecode / 8] >> (lengthDecode % 8)) & 1) != polarity)
+					break;
+			}
 
-			// operator SUB equals ADD(L,R^!) with inverted carry 
-			ebit = carry ^ L.bit ^ R.bit;
-			carry = carry ? L.bit | R.bit : L.bit & R.bit;
+			// decode value
+			int64_t n;
+			n = ib.decode(0);
+			unsigned end = ib.getpos();
 
-			// emit operator result
-			out.emitbit(ebit);
-		} while (L.state || R.state);
+			// table-driven and bit-serial decoder must agree on value and length
+			if (ib.decodeSerial(0) != n || ib.getpos() != end) {
+				fprintf(stderr, "decode/decodeSerial error. mem=%02x.%02x.%02x.%02x num=%ld\n",
+					mem[3], mem[2], mem[1], mem[0], n);
+				return 1;
+			}
 
-		// operator on final polarity
-		bool polarity = carry ^ L.bit ^ R.bit;
+			// encode it again after presetting all bits of destination
+			if (polarity)
+				mem[0] = mem[1] = 0xff;
+			else
+				mem[0] = mem[1] = 0x00;
+			ob.encode(0, n);
 
-		/*
-		 * @date 2020-07-15 12:11:26
-		 * The final carry(`ebit`) needs to be emitted which makes the result 1 bit longer.
-		 * Piggyback end-of-sequence-polarity of current streak of same polarity.
-		 * Let the caller finalise the end-of-sequence.
-		 */
-		out.emitEOSS(polarity);
+			// which bit is not part of the leading polarity
+			int lengthEncode = 0;
+			for (lengthEncode = 31; lengthEncode >= 0; --lengthEncode) {
+				if (((mem[lengthEncode / 8] >> (lengthEncode % 8)) & 1) != polarity)
+					break;
+			}
 
-		// finalise end-of-sequence
-		out.emitraw(polarity);
+			// encode may not be longer than what was decoded
+			if (lengthEncode > lengthDecode) {
+				fprintf(stderr, "decode/encode length error. mem=%02x.%02x.%02x.%02x num=%ld lengthDecode=%d lengthEncode=%d\n",
+					mem[3], mem[2], ((unsigned) num >> 8) & 0xff, (unsigned) num & 0xff, n, lengthDecode, lengthEncode);
+				return 1;
+			}
+		}
 	}
 
 	/*
-	 * @date 2020-07-08 18:56:29
-	 *
-	 * Streaming SUB
-	 *
-	 * NOTE: identical to `ADD` except right-hand-side and carry are inverted
-	 *
-	 * @param out - memory port for result
-	 * @param iOut - location of result
-	 * @param L - memory port left-hand-side
-	 * @param iL - location of left-hand-side
-	 * @param R - memory port right-hand-side
-	 * @param iR - location right-hand-side
+	 * Test unsigned `encode/decode` against bit-serial and the length from `ufrequency.c`
 	 */
-	inline void SUB(OUTBIT &out, unsigned iOut, INBIT &L, unsigned iL, INBIT &R, unsigned iR) {
+	UINBIT<RUNN> uib(mem), UL(mem), UR(mem);
+	UOUTBIT<RUNN> uob(mem);
 
-		// start engines
-		out.start(iOut);
-		L.start(iL);
-		R.start(iR);
+	for (uint64_t num = 0; num <= (1 << 14); num++) {
+		uob.encode(num & 7, num);
+		pos = uob.getpos();
+		uob.encodeSerial(2048, num);
 
-		bool ebit = 0;
-		bool carry = 1;
+		if (uob.getpos() - 2048 != pos - (num & 7) || !rawequal(mem, num & 7, mem, 2048, pos - (num & 7))) {
+			fprintf(stderr, "unsigned encode/encodeSerial error. num=%lu\n", num);
+			return 1;
+		}
 
-		do {
-			// load next data bit of input pipelines
-			L.nextbit();
-			R.nextbit();
+		// data bits, an escape per RUNN "0", RUNN+1 "0" terminator
+		unsigned length = RUNN + 1;
+		for (unsigned zeros = 0, k = 0; num >> k; k++) {
+			length++;
+			if ((num >> k) & 1)
+				zeros = 0;
+			else if (++zeros == RUNN) {
+				length++;
+				zeros = 0;
+			}
+		}
+		if (pos - (num & 7) != length) {
+			fprintf(stderr, "unsigned encode length error. num=%lu Expected=%u Encountered=%u\n", num, length, (unsigned) (pos - (num & 7)));
+			return 1;
+		}
 
-			// operator SUB equals ADD(L,R^!) with inverted carry 
-			ebit = carry ^ L.bit ^ R.bit ^ 1;
-			carry = carry ? L.bit | (R.bit ^ 1) : L.bit & (R.bit ^ 1);
+		uint64_t n = uib.decode(num & 7);
+		if (n != num || uib.getpos() != pos || uib.decodeSerial(num & 7) != num || uib.getpos() != pos) {
+			fprintf(stderr, "unsigned encode/decode error. Expected=%lu Encountered=%lu\n", num, n);
+			return 1;
+		}
+	}
 
-			// emit operator result
-			out.emitbit(ebit);
-		} while (L.state || R.state);
+	for (unsigned i = 0; i < (1 << 20); i++) {
+		uint64_t num = xorshift64();
+		// vary the width
+		num >>= num & 63;
 
-		// operator on final polarity
-		bool polarity = (carry ^ 1) ^ L.bit ^ R.bit;
+		uob.encode(i & 7, num);
+		pos = uob.getpos();
+		uob.encodeSerial(2048, num);
 
-		/*
-		 * @date 2020-07-15 12:11:26
-		 * The final carry(`ebit`) needs to be emitted which makes the result 1 bit longer.
-		 * Piggyback end-of-sequence-polarity of current streak of same polarity.
-		 * Let the caller finalise the end-of-sequence.
-		 */
-		out.emitEOSS(polarity);
+		if (uob.getpos() - 2048 != pos - (i & 7) || !rawequal(mem, i & 7, mem, 2048, pos - (i & 7))) {
+			fprintf(stderr, "unsigned encode/encodeSerial error. num=%lu\n", num);
+			return 1;
+		}
 
-		// finalise end-of-sequence
-		out.emitraw(polarity);
+		uint64_t n = uib.decode(i & 7);
+		if (n != num || uib.getpos() != pos || uib.decodeSerial(i & 7) != num || uib.getpos() != pos) {
+			fprintf(stderr, "unsigned encode/decode error. Expected=%lu Encountered=%lu\n", num, n);
+			return 1;
+		}
 	}
 
-	/**
-	 * @date 2020-07-15 12:36:50
-	 *
-	 * Logical shift left
-	 *
-	 * Left-hand-side is streaming
-	 * Right-hand-side is enumerated and large values can critically impact operations.
-	 * 
-	 * @date 2020-07-15 01:42:12
-	 * 
-	 * The shiftcount is most likely to be less than the length of the sequential memory storage.
-	 * right-hand-side could also be a string of which the length determines the shift count. 
-	 *
-	 * @param out - memory port for result
-	 * @param iOut - location of result
-	 * @param L - memory port left-hand-side
-	 * @param iL - location of left-hand-side
-	 * @param R - memory port right-hand-side
-	 * @param iR - location right-hand-side
-	 */
-	inline void LSL(OUTBIT &out, unsigned iOut, INBIT &L, unsigned iL, INBIT &R, unsigned iR) {
+	// quasi random memory
+	for (unsigned i = 0; i < (1 << 18); i++) {
+		for (unsigned k = 0; k < 64; k += 8) {
+			uint64_t r = xorshift64();
+			memcpy(mem + k, &r, sizeof r);
+		}
 
-		// decode rval
-		int rval = R.decode(iR);
+		unsigned start = i & 255;
+		uint64_t n = uib.decode(start);
+		unsigned end = uib.getpos();
+		if (uib.decodeSerial(start) != n || uib.getpos() != end) {
+			fprintf(stderr, "unsigned decode/decodeSerial error. start=%u\n", start);
+			return 1;
+		}
+		if (uib.skip(start) != end || uib.encodedLength(start) != end - start) {
+			fprintf(stderr, "unsigned skip error. start=%u Expected=%u Encountered=%u\n", start, end, uib.getpos());
+			return 1;
+		}
 
-		// start engines
-		out.start(iOut);
-		L.start(iL);
+#if defined(__x86_64__)
+		if (__builtin_cpu_supports("bmi2")) {
+			UINPEXT<RUNN> px(mem);
 
-		// emit `rval` number of "0"
-		while (rval > 0) {
-			out.emitbit(0);
-			--rval;
+			if (px.decode(start) != n || px.getpos() != end) {
+				fprintf(stderr, "UINPEXT::decode error. start=%u Expected=%lu\n", start, n);
+				return 1;
+			}
 		}
+#endif
+	}
 
-		// Copy lval to output
-		do {
-			L.nextbit();
-			out.emitbit(L.bit);
-		} while (L.state);
+	// all kernels supported by the CPU
+	for (unsigned k = 0; k < numKernels; k++) {
+		if (!kernelSelect(kernels[k].name))
+			continue; // not supported
 
-		// end-of-sequence marker
-		out.emitEOSS(L.bit);
+		for (unsigned i = 0; i < (1 << 16); i++) {
+			uint64_t num = xorshift64();
+			num >>= num & 63;
 
-		// finalise end-of-sequence
-		out.emitraw(L.bit);
+			pos = kernel<RUNN>().uencode(mem, i & 7, num);
+			unsigned end = serialUEncode<RUNN>(mem, 2048, num);
+
+			if (end - 2048 != pos - (i & 7) || !rawequal(mem, i & 7, mem, 2048, pos - (i & 7))) {
+				fprintf(stderr, "kernel %s unsigned encode error. num=%lu\n", kernels[kernelIndex].name, num);
+				return 1;
+			}
+
+			uint64_t n = kernel<RUNN>().udecode(mem, i & 7, &end);
+			if (n != num || end != pos) {
+				fprintf(stderr, "kernel %s unsigned decode error. Expected=%lu Encountered=%lu\n", kernels[kernelIndex].name, num, n);
+				return 1;
+			}
+		}
 	}
 
-	/**
-	 * @date 2020-07-15 12:39:51
-	 *
-	 * Logical shift right
-	 *
-	 * Left-hand-side is streaming
-	 * Right-hand-size is enumerated and large values can critically impact operations.
-	 *
-	 * @param out - memory port for result
-	 * @param iOut - location of result
-	 * @param L - memory port left-hand-side
-	 * @param iL - location of left-hand-side
-	 * @param R - memory port right-hand-side
-	 * @param iR - location right-hand-side
-	 */
-	inline void LSR(OUTBIT &out, unsigned iOut, INBIT &L, unsigned iL, INBIT &R, unsigned iR) {
+	// restore startup selection
+	kernelIndex = startup;
 
-		// decode rval
-		int rval = R.decode(iR);
+	/*
+	 * Test all the basic operators, exhaustive on concurrent threads
+	 */
+	{
+		VERIFIER<RUNN> verifier(aluBits, numThreads);
+		if (verifier.run())
+			return 1;
+	}
+	ALU<RUNN> alu;
 
-		// start engines
-		out.start(iOut);
-		L.start(iL);
+	/*
+	 * Native fast path and its fallbacks, operands of all widths up to 64 bits
+	 */
+	for (unsigned round = 0; round < 100000; round++) {
+		// operands of all widths, every other round near the limits of the word
+		unsigned spread = (round / 7) & 1 ? 4 : 64;
+		int64_t lval = (int64_t) xorshift64() >> (xorshift64() % spread);
+		int64_t rval = (int64_t) xorshift64() >> (xorshift64() % spread);
+		unsigned op = round % 8;
+
+		// shift counts from -4 to 69
+		if (op == 5 || op == 6)
+			rval = (int64_t) (xorshift64() % 74) - 4;
+
+		// results that do not fit a machine word decode to their lower 64 bits
+		int64_t expected = 0;
+		switch (op) {
+		case 0: expected = (uint64_t) lval + rval; break;
+		case 1: expected = (uint64_t) lval - rval; break;
+		case 2: expected = lval & rval; break;
+		case 3: expected = lval ^ rval; break;
+		case 4: expected = lval | rval; break;
+		case 5: expected = rval <= 0 ? lval : rval < 64 ? (uint64_t) lval << rval : 0; break;
+		case 6: expected = rval <= 0 ? lval : lval >> (rval < 63 ? rval : 63); break;
+		case 7: expected = (uint64_t) lval * rval; break;
+		}
 
-		// Copy lval to output skipping first `rval` bits
-		do {
-			L.nextbit();
-			if (--rval < 0)
-				out.emitbit(L.bit);
-		} while (L.state);
+		ob.encode(0, lval);
+		ob.encode(256, rval);
+
+		// streaming result at 512, native at 1024
+		for (unsigned mode = 0; mode < 2; mode++) {
+			unsigned iOut = mode ? 1024 : 512;
+			alu.native = mode;
+
+			switch (op) {
+			case 0: alu.ADD(ob, iOut, L, 0, R, 256); break;
+			case 1: alu.SUB(ob, iOut, L, 0, R, 256); break;
+			case 2: alu.AND(ob, iOut, L, 0, R, 256); break;
+			case 3: alu.XOR(ob, iOut, L, 0, R, 256); break;
+			case 4: alu.OR(ob, iOut, L, 0, R, 256); break;
+			case 5: alu.LSL(ob, iOut, L, 0, R, 256); break;
+			case 6: alu.LSR(ob, iOut, L, 0, R, 256); break;
+			case 7: alu.MUL(ob, iOut, L, 0, R, 256); break;
+			}
 
-		// end-of-sequence marker
-		out.emitEOSS(L.bit);
+			unsigned end = ob.getpos();
+			int64_t answer = ib.decode(iOut);
+			if (answer != expected || ib.getpos() != end) {
+				fprintf(stderr, "native error 0x%lx op=%u 0x%lx mode=%u. Expected=0x%lx Encountered 0x%lx\n", lval, op, rval, mode, expected, answer);
+				return 1;
+			}
+		}
 
-		// finalise end-of-sequence
-		out.emitraw(L.bit);
+		// also bits beyond the machine word
+		if (!valueequal<RUNN>(mem, 512, mem, 1024)) {
+			fprintf(stderr, "native error 0x%lx op=%u 0x%lx\n", lval, op, rval);
+			return 1;
+		}
 	}
+	alu.native = true;
 
-	/**
-	 * @date 2020-07-15 12:22:27
-	 *
-	 * Streaming AND
-	 *
-	 * @param out - memory port for result
-	 * @param iOut - location of result
-	 * @param L - memory port left-hand-side
-	 * @param iL - location of left-hand-side
-	 * @param R - memory port right-hand-side
-	 * @param iR - location right-hand-side
+	/*
+	 * Streaming MUL beyond the machine word, checked by identities
 	 */
-	inline void AND(OUTBIT &out, unsigned iOut, INBIT &L, unsigned iL, INBIT &R, unsigned iR) {
+	{
+		enum {
+			SLOT = 2048, // bits reserved per operand/result
+		};
+
+		unsigned char *pMul = (unsigned char *) calloc(9 * SLOT / 8 + 16, 1);
+		INBIT<RUNN> mL(pMul), mR(pMul);
+		OUTBIT<RUNN> mob(pMul);
+
+		for (unsigned round = 0; round < 300; round++) {
+			alu.native = round & 1;
+			alu.limbs = round % 3 != 0;
+
+			// a, b, c of random length and polarity, also powers of two and all ones
+			for (unsigned k = 0; k < 3; k++) {
+				unsigned length = xorshift64() % ((round & 2) ? 400 : 70);
+				bool polarity = xorshift64() & 1;
+				unsigned payload = (round >> (2 + 2 * k)) & 3;
+				uint64_t rnd = 0;
+
+				mob.start(k * SLOT + (round & 7));
+				for (unsigned j = 0; j < length; j++) {
+					if (!(j & 63))
+						rnd = payload == 1 ? 0 : payload == 2 ? ~0ULL : xorshift64();
+					mob.emitbit((rnd >> (j & 63)) & 1);
+				}
+				mob.emitEOSS(polarity);
+				mob.emitraw(polarity);
+				mob.flush();
+			}
+			unsigned iA = round & 7, iB = SLOT + (round & 7), iC = 2 * SLOT + (round & 7);
+
+			// a*(b+c) == a*b + a*c
+			alu.ADD(mob, 3 * SLOT, mL, iB, mR, iC);
+			alu.MUL(mob, 4 * SLOT, mL, iA, mR, 3 * SLOT);
+			alu.MUL(mob, 5 * SLOT, mL, iA, mR, iB);
+			alu.MUL(mob, 6 * SLOT, mL, iA, mR, iC);
+			alu.ADD(mob, 7 * SLOT, mL, 5 * SLOT, mR, 6 * SLOT);
+			if (!valueequal<RUNN>(pMul, 4 * SLOT, pMul, 7 * SLOT)) {
+				fprintf(stderr, "MUL distributive error. round=%u\n", round);
+				return 1;
+			}
 
-		// start engines
-		out.start(iOut);
-		L.start(iL);
-		R.start(iR);
+			// b*a == a*b
+			alu.MUL(mob, 7 * SLOT, mL, iB, mR, iA);
+			if (!valueequal<RUNN>(pMul, 5 * SLOT, pMul, 7 * SLOT)) {
+				fprintf(stderr, "MUL commutative error. round=%u\n", round);
+				return 1;
+			}
 
-		do {
-			// load next data bit of input pipelines
-			L.nextbit();
-			R.nextbit();
+			// limbs against bit-serial
+			alu.limbs = !alu.limbs;
+			alu.MUL(mob, 7 * SLOT, mL, iA, mR, iB);
+			alu.limbs = !alu.limbs;
+			if (!valueequal<RUNN>(pMul, 5 * SLOT, pMul, 7 * SLOT)) {
+				fprintf(stderr, "MUL limbs error. round=%u\n", round);
+				return 1;
+			}
 
-			// operator 
-			bool ebit = L.bit & R.bit;
+			// a*2^s == a<<s
+			unsigned shift = xorshift64() % 62;
+			mob.encode(8 * SLOT, (int64_t) 1 << shift);
+			alu.MUL(mob, 5 * SLOT, mL, iA, mR, 8 * SLOT);
+			mob.encode(8 * SLOT, shift);
+			alu.LSL(mob, 6 * SLOT, mL, iA, mR, 8 * SLOT);
+			if (!valueequal<RUNN>(pMul, 5 * SLOT, pMul, 6 * SLOT)) {
+				fprintf(stderr, "MUL shift error. round=%u shift=%u\n", round, shift);
+				return 1;
+			}
+		}
+		alu.native = true;
+		alu.limbs = true;
 
-			// emit operator result
-			out.emitbit(ebit);
-		} while (L.state || R.state);
+		free(pMul);
+	}
+
+	/*
+	 * Karatsuba and Toom-3 against schoolbook, then limb MUL against bit-serial with operands of several Toom-3 levels
+	 */
+	{
+		enum {
+			MAXLIMBS = 200,
+			SLOT = 131072, // bits reserved per operand/result
+		};
+
+		uint64_t *pA = (uint64_t *) malloc(MAXLIMBS * sizeof *pA);
+		uint64_t *pB = (uint64_t *) malloc(MAXLIMBS * sizeof *pB);
+		uint64_t *pExpected = (uint64_t *) malloc(2 * MAXLIMBS * sizeof *pExpected);
+		uint64_t *pProd = (uint64_t *) malloc(2 * MAXLIMBS * sizeof *pProd);
+
+		// every level of recursion uses the sub-quadratic methods
+		BIGMUL low;
+		low.karatsubaLimbs = 2;
+		low.toom3Limbs = 7;
+
+		for (unsigned round = 0; round < 300; round++) {
+			// balanced and unbalanced, also maximal limbs and carries
+			unsigned nA = 1 + xorshift64() % ((round & 1) ? MAXLIMBS : 40);
+			unsigned nB = (round & 2) ? nA : 1 + xorshift64() % nA;
+			unsigned payload = (round >> 2) & 3;
+
+			// exact division by 3 of a multiple with zero limbs, `2^64 mod 3` is 1
+			uint64_t mod3 = 0;
+			for (unsigned i = 0; i < nA; i++) {
+				pExpected[i] = (i & 1) && (xorshift64() & 1) ? 0 : xorshift64() | 4;
+				mod3 += pExpected[i] % 3;
+			}
+			pExpected[0] -= mod3 % 3;
+			memcpy(pProd, pExpected, nA * sizeof *pProd);
+			BIGMUL::divexact3(pProd, nA);
+			memset(pA, 0, nA * sizeof *pA);
+			BIGMUL::muladd1(pA, pProd, nA, 3);
+			if (memcmp(pA, pExpected, nA * sizeof *pA) != 0) {
+				fprintf(stderr, "BIGMUL divexact3 error. round=%u nA=%u\n", round, nA);
+				return 1;
+			}
+
+			for (unsigned i = 0; i < MAXLIMBS; i++) {
+				pA[i] = payload == 1 ? ~0ULL : payload >= 2 ? xorshift64() & 0x8000000000000001ULL : xorshift64();
+				pB[i] = payload == 1 || payload == 2 ? ~0ULL : payload == 3 ? xorshift64() & 0x8000000000000001ULL : xorshift64();
+			}
+
+			BIGMUL::schoolbook(pExpected, pA, nA, pB, nB);
+			for (unsigned k = 0; k < 2; k++) {
+				if (k)
+					alu.bigmul.mul(pProd, pA, nA, pB, nB);
+				else
+					low.mul(pProd, pA, nA, pB, nB);
+				if (memcmp(pProd, pExpected, (nA + nB) * sizeof *pProd) != 0) {
+					fprintf(stderr, "BIGMUL error. round=%u nA=%u nB=%u thresholds=%s\n", round, nA, nB, k ? "default" : "low");
+					return 1;
+				}
+			}
+		}
+
+		free(pProd);
+		free(pExpected);
+		free(pB);
+		free(pA);
+
+		unsigned char *pMul = (unsigned char *) calloc(4 * SLOT / 8 + 16, 1);
+		INBIT<RUNN> mL(pMul), mR(pMul);
+		OUTBIT<RUNN> mob(pMul);
+
+		alu.native = false;
+		for (unsigned round = 0; round < 2; round++) {
+			// operands of over 20000 bits, one of them negative
+			for (unsigned k = 0; k < 2; k++) {
+				mob.start(k * SLOT);
+				for (unsigned j = 0; j < 21000 + 1000 * round; j++)
+					mob.emitbit(xorshift64() & 1);
+				mob.emitEOSS(k);
+				mob.emitraw(k);
+				mob.flush();
+			}
 
-		// final polarity
-		bool polarity = L.bit & R.bit;
+			alu.limbs = false;
+			alu.MUL(mob, 2 * SLOT, mL, 0, mR, SLOT);
+			unsigned endL = mL.getpos(), endR = mR.getpos();
+			alu.limbs = true;
+			alu.MUL(mob, 3 * SLOT, mL, 0, mR, SLOT);
 
-		// end-of-sequence marker
-		out.emitEOSS(polarity);
+			if (!valueequal<RUNN>(pMul, 2 * SLOT, pMul, 3 * SLOT) || mL.getpos() != endL || mR.getpos() != endR || mL.state || mR.state || mR.bit != 1) {
+				fprintf(stderr, "BIGMUL limbs error. round=%u\n", round);
+				return 1;
+			}
+		}
+		alu.native = true;
 
-		// finalise end-of-sequence
-		out.emitraw(polarity);
+		free(pMul);
 	}
 
-	/**
-	 * @date 2020-07-15 12:31:06
-	 *
-	 * Streaming XOR
-	 *
-	 * @param out - memory port for result
-	 * @param iOut - location of result
-	 * @param L - memory port left-hand-side
-	 * @param iL - location of left-hand-side
-	 * @param R - memory port right-hand-side
-	 * @param iR - location right-hand-side
+	/*
+	 * Knuth division against restoring, then DIV/MOD of long operands by `x == q * d + r` and `|r| < |d|`
 	 */
-	inline void XOR(OUTBIT &out, unsigned iOut, INBIT &L, unsigned iL, INBIT &R, unsigned iR) {
-
-		// start engines
-		out.start(iOut);
-		L.start(iL);
-		R.start(iR);
-
-		do {
-			// load next data bit of input pipelines
-			L.nextbit();
-			R.nextbit();
-
-			// operator 
-			bool ebit = L.bit ^ R.bit;
+	{
+		enum {
+			MAXLIMBS = 40,
+			SLOT = 8192, // bits reserved per operand/result
+		};
+
+		uint64_t *pU = (uint64_t *) malloc((MAXLIMBS + 1) * sizeof *pU);
+		uint64_t *pV = (uint64_t *) malloc(MAXLIMBS * sizeof *pV);
+		uint64_t *pOrig = (uint64_t *) malloc(MAXLIMBS * sizeof *pOrig);
+		uint64_t *pRem = (uint64_t *) malloc(MAXLIMBS * sizeof *pRem);
+		uint64_t *pQ = (uint64_t *) malloc(MAXLIMBS * sizeof *pQ);
+		uint64_t *pQ2 = (uint64_t *) malloc(MAXLIMBS * sizeof *pQ2);
+		uint64_t *pWork = (uint64_t *) malloc((MAXLIMBS + 1) * sizeof *pWork);
+		uint64_t *pCheck = (uint64_t *) malloc(2 * MAXLIMBS * sizeof *pCheck);
+
+		// limbs near the corrections of the quotient estimate
+		static const uint64_t edges[] = {0, 1, ~0ULL, 1ULL << 63, (1ULL << 63) - 1, ~0ULL - 1};
+
+		for (unsigned round = 0; round < 2000; round++) {
+			unsigned m = 1 + xorshift64() % MAXLIMBS;
+			unsigned n = 1 + xorshift64() % m;
+			bool edge = round & 1;
+
+			for (unsigned i = 0; i < m; i++)
+				pOrig[i] = edge ? edges[xorshift64() % 6] : xorshift64();
+			for (unsigned i = 0; i < n; i++)
+				pV[i] = edge ? edges[xorshift64() % 6] : xorshift64();
+			if (round & 2)
+				pV[n - 1] >>= xorshift64() % 64; // various normalisation shifts
+			if (!pV[n - 1])
+				pV[n - 1] = 1;
+
+			memcpy(pU, pOrig, m * sizeof *pU);
+			BIGDIV::knuth(pQ, pU, m, pV, n);
+			memcpy(pRem, pOrig, m * sizeof *pRem);
+			BIGDIV::restoring(pQ2, pRem, m, pV, n, pWork);
+
+			// same quotient and remainder, divisor restored
+			bool ok = memcmp(pQ, pQ2, (m - n + 1) * sizeof *pQ) == 0 && memcmp(pU, pRem, m * sizeof *pU) == 0;
+			for (unsigned i = m - n + 1; i < m; i++)
+				ok = ok && !pQ2[i];
+
+			// `q * v + r == u` and `r < v`
+			BIGMUL::schoolbook(pCheck, pQ, m - n + 1, pV, n);
+			ok = ok && !BIGMUL::addto(pCheck, m + 1, pRem, n) && !pCheck[m] && memcmp(pCheck, pOrig, m * sizeof *pCheck) == 0;
+			ok = ok && BIGMUL::sub(pWork, pRem, pV, n);
+
+			if (!ok) {
+				fprintf(stderr, "BIGDIV error. round=%u m=%u n=%u\n", round, m, n);
+				return 1;
+			}
+		}
 
-			// emit operator result
-			out.emitbit(ebit);
-		} while (L.state || R.state);
+		free(pCheck);
+		free(pWork);
+		free(pQ2);
+		free(pQ);
+		free(pRem);
+		free(pOrig);
+		free(pV);
+		free(pU);
+
+		unsigned char *pDiv = (unsigned char *) calloc(8 * SLOT / 8 + 16, 1);
+		INBIT<RUNN> dL(pDiv), dR(pDiv);
+		OUTBIT<RUNN> dob(pDiv);
+
+		for (unsigned round = 0; round < 60; round++) {
+			// dividend up to 2000 bits, divisor from a few bits to longer than the dividend, also zero
+			unsigned length[2];
+			length[0] = xorshift64() % 2000;
+			length[1] = round % 10 == 0 ? 0 : 1 + xorshift64() % (round & 1 ? 64 : length[0] + 100);
+
+			for (unsigned k = 0; k < 2; k++) {
+				bool polarity = round % 10 != 0 || k == 0 ? xorshift64() & 1 : 0;
+				dob.start(k * SLOT);
+				for (unsigned j = 0; j < length[k]; j++)
+					dob.emitbit(k && j == length[k] - 1 ? !polarity : xorshift64() & 1); // divisor is not zero
+				dob.emitEOSS(polarity);
+				dob.emitraw(polarity);
+				dob.flush();
+			}
 
-		// final polarity
-		bool polarity = L.bit ^ R.bit;
+			// restoring and Knuth
+			for (unsigned k = 0; k < 2; k++) {
+				alu.limbs = k;
+				alu.DIV(dob, (2 + 2 * k) * SLOT, dL, 0, dR, SLOT);
+				alu.MOD(dob, (3 + 2 * k) * SLOT, dL, 0, dR, SLOT);
+			}
+			alu.limbs = true;
+
+			bool ok = valueequal<RUNN>(pDiv, 2 * SLOT, pDiv, 4 * SLOT) && valueequal<RUNN>(pDiv, 3 * SLOT, pDiv, 5 * SLOT);
+
+			if (round % 10 == 0) {
+				// division by zero
+				dob.encode(6 * SLOT, -1);
+				ok = ok && valueequal<RUNN>(pDiv, 2 * SLOT, pDiv, 6 * SLOT) && valueequal<RUNN>(pDiv, 3 * SLOT, pDiv, 0);
+			} else {
+				// `q * d + r`
+				alu.MUL(dob, 6 * SLOT, dL, 2 * SLOT, dR, SLOT);
+				alu.ADD(dob, 7 * SLOT, dL, 6 * SLOT, dR, 3 * SLOT);
+				ok = ok && valueequal<RUNN>(pDiv, 7 * SLOT, pDiv, 0);
+
+				// remainder zero or sign of dividend, `-|d| < r < |d|`
+				bool negL = DIVCONST<RUNN>::negative(dL, 0), negR = DIVCONST<RUNN>::negative(dR, SLOT);
+				bool zeroRem = DIVCONST<RUNN>::zero(dL, 3 * SLOT);
+				ok = ok && (zeroRem || DIVCONST<RUNN>::negative(dL, 3 * SLOT) == negL);
+				alu.ADD(dob, 6 * SLOT, dL, 3 * SLOT, dR, SLOT);
+				alu.SUB(dob, 7 * SLOT, dL, 3 * SLOT, dR, SLOT);
+				ok = ok && !DIVCONST<RUNN>::zero(dL, 6 * SLOT) && DIVCONST<RUNN>::negative(dL, 6 * SLOT) == negR;
+				ok = ok && !DIVCONST<RUNN>::zero(dL, 7 * SLOT) && DIVCONST<RUNN>::negative(dL, 7 * SLOT) != negR;
+			}
 
-		// end-of-sequence marker
-		out.emitEOSS(polarity);
+			if (!ok) {
+				fprintf(stderr, "DIV/MOD error. round=%u lengths=%u,%u\n", round, length[0], length[1]);
+				return 1;
+			}
+		}
 
-		// finalise end-of-sequence
-		out.emitraw(polarity);
+		free(pDiv);
 	}
 
-	/**
-	 * @date 2020-07-15 12:32:23
-	 *
-	 * Streaming OR
-	 *
-	 * @param out - memory port for result
-	 * @param iOut - location of result
-	 * @param L - memory port left-hand-side
-	 * @param iL - location of left-hand-side
-	 * @param R - memory port right-hand-side
-	 * @param iR - location right-hand-side
+	/*
+	 * Division by constants against native, then beyond the machine word by `x == q * d + r`
 	 */
-	inline void OR(OUTBIT &out, unsigned iOut, INBIT &L, unsigned iL, INBIT &R, unsigned iR) {
+	{
+		static const int64_t divisors[] = {1000, 60, 24, 3, 6, 9, 15, 165, 1, 2, 7, 641, 1019, -1000000007, 1LL << 40, INT64_MAX, -7, -1, 0, INT64_MIN};
+		enum {
+			SLOT = 2048, // bits reserved per operand/result
+		};
+
+		unsigned char *pDiv = (unsigned char *) calloc(6 * SLOT / 8 + 16, 1);
+		INBIT<RUNN> dL(pDiv), dR(pDiv), dib(pDiv);
+		OUTBIT<RUNN> dob(pDiv);
+
+		// the hand-derived schedules of `div6()`, `div9()` and `div15()` in `div.c`
+		static const struct {
+			int64_t divisor;
+			int terms[2]; // preamble, `+k` or `-k`, 0 ends
+			int steps[3];
+			unsigned scale;
+		} hand[] = {
+			{6,  {+1, 0},  {2, 4, 8},   2 + 1},
+			{9,  {-1, +4}, {6, 12, 24}, 6},
+			{15, {+1, 0},  {4, 8, 16},  4},
+		};
+		for (auto &h : hand) {
+			DIVCONST<RUNN> dc(h.divisor);
+
+			bool ok = dc.numSteps >= 3 && memcmp(dc.pSteps, h.steps, sizeof h.steps) == 0 && dc.scale + dc.shift == h.scale;
+			for (unsigned i = 0; i < 2; i++) {
+				int term = i < dc.numTerms ? (dc.terms[i].negative ? -1 : +1) * (int) (dc.terms[i].k + 1) : 0;
+				ok = ok && term == h.terms[i];
+			}
+			if (!ok) {
+				fprintf(stderr, "DIVCONST schedule error divisor=%ld\n", (long) h.divisor);
+				return 1;
+			}
+		}
 
-		// start engines
-		out.start(iOut);
-		L.start(iL);
-		R.start(iR);
+		for (int64_t d : divisors) {
+			DIVCONST<RUNN> dc(d);
+
+			for (unsigned round = 0; round < 400; round++) {
+				dc.alu.native = round & 1;
+				dc.fixed = round & 2;
+
+				// dividends of all widths, also exact multiples and their neighbours
+				int64_t lval = (int64_t) xorshift64() >> (xorshift64() % 64);
+				if (round % 5 == 0 && d)
+					lval = (lval / d) * d + (int64_t) (round % 3) - 1;
+				if (round == 2)
+					lval = INT64_MIN;
+
+				int64_t quot, rem;
+				if (!d) {
+					quot = -1;
+					rem = lval;
+				} else if (d == -1) {
+					quot = -(uint64_t) lval; // `INT64_MIN` has no positive counterpart
+					rem = 0;
+				} else {
+					quot = lval / d;
+					rem = lval % d;
+				}
 
-		do {
-			// load next data bit of input pipelines
-			L.nextbit();
-			R.nextbit();
+				dob.encode(0, lval);
+				dc.DIV(dob, SLOT, dL, 0);
+				dc.MOD(dob, 2 * SLOT, dL, 0);
+				if (dib.decode(SLOT) != quot || dib.decode(2 * SLOT) != rem) {
+					fprintf(stderr, "DIVCONST error %ld / %ld native=%d. Expected=%ld,%ld Encountered %ld,%ld\n",
+						lval, d, dc.alu.native, quot, rem, dib.decode(SLOT), dib.decode(2 * SLOT));
+					return 1;
+				}
+			}
 
-			// operator 
-			bool ebit = L.bit | R.bit;
+			// dividends up to 1000 bits
+			for (unsigned round = 0; round < 20; round++) {
+				unsigned length = xorshift64() % 1000;
+				bool polarity = xorshift64() & 1;
+				uint64_t rnd = 0;
+				dc.fixed = round & 1;
+
+				dob.start(0);
+				for (unsigned j = 0; j < length; j++) {
+					if (!(j & 63))
+						rnd = xorshift64();
+					dob.emitbit((rnd >> (j & 63)) & 1);
+				}
+				dob.emitEOSS(polarity);
+				dob.emitraw(polarity);
+				dob.flush();
+
+				dc.DIV(dob, SLOT, dL, 0);
+				dc.MOD(dob, 2 * SLOT, dL, 0);
+
+				// `|r| < |d|` with sign of dividend, the encoding may have leading zeros
+				int64_t rem = dib.decode(2 * SLOT);
+				uint64_t absRem = rem < 0 ? -(uint64_t) rem : rem, absDiv = d < 0 ? -(uint64_t) d : d;
+				dob.encode(3 * SLOT, rem);
+				bool fits = valueequal<RUNN>(pDiv, 2 * SLOT, pDiv, 3 * SLOT);
+				if (d && (!fits || absRem >= absDiv || (rem && (rem < 0) != polarity))) {
+					fprintf(stderr, "DIVCONST remainder error. d=%ld round=%u\n", d, round);
+					return 1;
+				}
 
-			// emit operator result
-			out.emitbit(ebit);
-		} while (L.state || R.state);
+				// q * d + r
+				dob.encode(3 * SLOT, d);
+				alu.MUL(dob, 4 * SLOT, dL, SLOT, dR, 3 * SLOT);
+				alu.ADD(dob, 5 * SLOT, dL, 4 * SLOT, dR, 2 * SLOT);
+				if (!valueequal<RUNN>(pDiv, 0, pDiv, d ? 5 * SLOT : 2 * SLOT)) {
+					fprintf(stderr, "DIVCONST quotient error. d=%ld round=%u\n", d, round);
+					return 1;
+				}
+			}
+		}
 
-		// final polarity
-		bool polarity = L.bit | R.bit;
+		free(pDiv);
+	}
 
-		// end-of-sequence marker
-		out.emitEOSS(polarity);
+	/*
+	 * Multiplication by constants against MUL, all modes, operands of all lengths
+	 */
+	{
+		static const int64_t multipliers[] = {10, 1000, 3600, 0, 1, -1, 2, 3, -7, 0x5555555555555555LL, -(1LL << 40), INT64_MAX, INT64_MIN};
+		enum {
+			SLOT = 4096, // bits reserved per operand/result
+		};
+
+		unsigned char *pMulc = (unsigned char *) calloc(4 * SLOT / 8 + 16, 1);
+		INBIT<RUNN> cL(pMulc), cR(pMulc);
+		OUTBIT<RUNN> cob(pMulc);
+
+		// the recoding of `10`, `1000` and `3600`
+		static const struct {
+			uint64_t positive, negative;
+		} recoded[] = {
+			{1 << 3 | 1 << 1,  0},
+			{1 << 10 | 1 << 3, 1 << 5},
+			{1 << 12 | 1 << 4, 1 << 9},
+		};
+		for (unsigned i = 0; i < 3; i++) {
+			MULC<RUNN> mc(multipliers[i]);
+			if (mc.positive != recoded[i].positive || mc.negative != recoded[i].negative) {
+				fprintf(stderr, "MULC recode error. multiplier=%ld\n", (long) multipliers[i]);
+				return 1;
+			}
+		}
 
-		// finalise end-of-sequence
-		out.emitraw(polarity);
-	}
+		for (int64_t c : multipliers) {
+			MULC<RUNN> mc(c);
 
-};
+			// non-adjacent form
+			uint64_t digits = mc.positive | mc.negative;
+			if ((digits & digits << 1) || (mc.positive & mc.negative)) {
+				fprintf(stderr, "MULC recode error. multiplier=%ld\n", (long) c);
+				return 1;
+			}
 
-/*
- * @date 2020-07-08 00:33:53
- *
- * Signal handler for timer tick
- */
-void sigAlarm(int sig) {
-	tick++;
-	alarm(1);
-}
+			for (int64_t lval = -(1 << aluBits); lval <= +(1 << aluBits) + 40; lval++) {
+				// alternate between native fast path, limbs and bit-serial
+				unsigned mode = lval & 3;
+				mc.native = mode == 0;
+				mc.limbs = mode == 1;
+
+				// long operands after the range
+				if (lval <= +(1 << aluBits)) {
+					cob.encode(0, lval);
+				} else {
+					bool polarity = xorshift64() & 1;
+					unsigned length = lval & 4 ? 40 + lval % 32 : xorshift64() % 2000; // also around the chunk boundary
+					cob.start(0);
+					for (unsigned j = 0; j < length; j++)
+						cob.emitbit(xorshift64() & 1);
+					cob.emitEOSS(polarity);
+					cob.emitraw(polarity);
+					cob.flush();
+				}
+				cob.encode(SLOT, c);
 
-unsigned char mem[512];
-unsigned pos;
+				mc.MUL(cob, 2 * SLOT, cL, 0);
+				unsigned end = cL.getpos();
+				alu.MUL(cob, 3 * SLOT, cL, 0, cR, SLOT);
 
-int main() {
-	setlinebuf(stdout);
-	signal(SIGALRM, sigAlarm);
-	alarm(1);
+				if (!valueequal<RUNN>(pMulc, 2 * SLOT, pMulc, 3 * SLOT) || cL.getpos() != end || cL.state) {
+					fprintf(stderr, "MULC error. multiplier=%ld lval=%ld mode=%u\n", (long) c, (long) lval, mode);
+					return 1;
+				}
+			}
+		}
 
-	INBIT ib(mem), L(mem), R(mem);
-	OUTBIT ob(mem);
+		free(pMulc);
+	}
 
 	/*
-	 * Display numbers for visual inspection
+	 * Fused shiftADD/shiftSUB/shiftOR against LSL followed by the operator, limbs against bit-serial
 	 */
-	if (0) {
-		for (int64_t num = -128; num <= +128; num++) {
-			// rewind memory
-			pos = 0;
-
-			// encode test value
-			ob.encode(pos, num);
-			pos = ob.getpos();
+	{
+		enum {
+			SLOT = 4096, // bits reserved per operand/result
+		};
+
+		unsigned char *pShift = (unsigned char *) calloc(8 * SLOT / 8 + 16, 1);
+		INBIT<RUNN> sL(pShift), sR(pShift);
+		OUTBIT<RUNN> sob(pShift);
+
+		for (unsigned round = 0; round < 6000; round++) {
+			unsigned opcode = round % 3;
+			bool longer = round >= 5000;
+			unsigned fill = xorshift64() % (longer ? 300 : round & 8 ? 4 : 80);
+
+			// operands that fit a word, then up to 1500 bits
+			for (unsigned k = 0; k < 2; k++) {
+				if (!longer) {
+					sob.encode(k * SLOT, (int64_t) xorshift64() >> (xorshift64() % 64));
+					continue;
+				}
+				bool polarity = xorshift64() & 1;
+				unsigned length = xorshift64() % 1500;
+				sob.start(k * SLOT);
+				for (unsigned j = 0; j < length; j++)
+					sob.emitbit(xorshift64() & 1);
+				sob.emitEOSS(polarity);
+				sob.emitraw(polarity);
+				sob.flush();
+			}
 
-			printf("%3d: ", (int) num);
+			// reference
+			sob.encode(2 * SLOT, fill);
+			alu.LSL(sob, 3 * SLOT, sL, SLOT, sR, 2 * SLOT);
+			switch (opcode) {
+			case 0: alu.ADD(sob, 4 * SLOT, sL, 0, sR, 3 * SLOT); break;
+			case 1: alu.SUB(sob, 4 * SLOT, sL, 0, sR, 3 * SLOT); break;
+			case 2: alu.OR(sob, 4 * SLOT, sL, 0, sR, 3 * SLOT); break;
+			}
 
-			// display encoded answer
-			ib.start(0);
-			unsigned k;
-			for (k = 0; k < pos; k++)
-				putchar(ib.nextraw() ? '1' : '0');
+			// native, limbs and bit-serial
+			unsigned end[3];
+			for (unsigned mode = 0; mode < 3; mode++) {
+				alu.native = mode == 0;
+				alu.limbs = mode == 1;
+				switch (opcode) {
+				case 0: alu.shiftADD(sob, (5 + mode) * SLOT, sL, 0, sR, SLOT, fill); break;
+				case 1: alu.shiftSUB(sob, (5 + mode) * SLOT, sL, 0, sR, SLOT, fill); break;
+				case 2: alu.shiftOR(sob, (5 + mode) * SLOT, sL, 0, sR, SLOT, fill); break;
+				}
+				end[mode] = sob.getpos() - (5 + mode) * SLOT;
 
-			// decode value
-			int64_t n;
-			n = ib.decode(0);
-			printf(" [%ld]", n);
+				if (!valueequal<RUNN>(pShift, 4 * SLOT, pShift, (5 + mode) * SLOT) || sR.state || sL.state) {
+					fprintf(stderr, "shift operator error. opcode=%u fill=%u mode=%u round=%u\n", opcode, fill, mode, round);
+					return 1;
+				}
+			}
+			alu.native = true;
+			alu.limbs = true;
 
-			putchar('\n');
+			// limbs and bit-serial produce identical output
+			if (end[1] != end[2] || !rawequal(pShift, 6 * SLOT, pShift, 7 * SLOT, end[1])) {
+				fprintf(stderr, "shift operator limbs error. opcode=%u fill=%u round=%u\n", opcode, fill, round);
+				return 1;
+			}
 		}
+
+		free(pShift);
 	}
 
 	/*
-	 * Test that `encode/decode` counter each other.
+	 * Fixed-point operators against exact expectations, point and mantissa
 	 */
-	for (int64_t num = +(1 << 13); num <= +(1 << 13); num++) {
-		// rewind memory
-		pos = 0;
+	{
+		enum {
+			SLOT = 1024, // bits reserved per operand/result
+		};
+
+		unsigned char *pFix = (unsigned char *) calloc(4 * SLOT / 8 + 16, 1);
+		INBIT<RUNN> fL(pFix), fR(pFix);
+		OUTBIT<RUNN> fob(pFix);
+		FIXALU<RUNN> fa;
+
+		for (unsigned round = 0; round < 6000; round++) {
+			unsigned opcode = round % 6;
+			int64_t m1 = (int32_t) xorshift64() >> (xorshift64() % 32), m2 = (int32_t) xorshift64() >> (xorshift64() % 32);
+			unsigned p1 = xorshift64() % 21, p2 = xorshift64() % 21, count = xorshift64() % 26;
+			fa.alu.native = round & 1;
+			fa.alu.limbs = round & 2;
+
+			FIXALU<RUNN>::encode(fob, 0, m1, p1);
+			FIXALU<RUNN>::encode(fob, SLOT, m2, p2);
+
+			// expected `mantissa * 2^-point`
+			unsigned point = p1 > p2 ? p1 : p2;
+			int64_t mantissa = 0;
+			switch (opcode) {
+			case 0:
+				fa.ADD(fob, 2 * SLOT, fL, 0, fR, SLOT);
+				mantissa = m1 * (1LL << (point - p1)) + m2 * (1LL << (point - p2));
+				break;
+			case 1:
+				fa.SUB(fob, 2 * SLOT, fL, 0, fR, SLOT);
+				mantissa = m1 * (1LL << (point - p1)) - m2 * (1LL << (point - p2));
+				break;
+			case 2:
+				fa.MUL(fob, 2 * SLOT, fL, 0, fR, SLOT);
+				point = p1 + p2;
+				mantissa = m1 * m2;
+				break;
+			case 3:
+				fa.LSR(fob, 2 * SLOT, fL, 0, count);
+				point = p1 + count;
+				mantissa = m1;
+				break;
+			case 4:
+				fa.LSL(fob, 2 * SLOT, fL, 0, count);
+				point = p1 >= count ? p1 - count : 0;
+				mantissa = p1 >= count ? m1 : m1 * (1LL << (count - p1));
+				break;
+			case 5:
+				// integer, no point
+				fa.FLOOR(fob, 2 * SLOT, fL, 0);
+				point = 0;
+				mantissa = m1 >> p1;
+				break;
+			}
 
-		// encode test value
-		ob.encode(pos, num);
-		pos = ob.getpos();
+			unsigned iM = 2 * SLOT;
+			unsigned encountered = opcode == 5 ? 0 : FIXALU<RUNN>::point(fL, 2 * SLOT, iM);
+			fob.encode(3 * SLOT, mantissa);
+			if (encountered != point || !valueequal<RUNN>(pFix, iM, pFix, 3 * SLOT)) {
+				fprintf(stderr, "FIXALU error. opcode=%u m1=%ld p1=%u m2=%ld p2=%u count=%u\n", opcode, (long) m1, p1, (long) m2, p2, count);
+				return 1;
+			}
+		}
 
-		// decode value
-		int64_t n;
-		n = ib.decode(0);
+		free(pFix);
+	}
 
-		if (n != num) {
-			fprintf(stderr, "encode/decode error. Expected=%ld Encountered=%ld\n", num, n);
-			return 1;
+	/*
+	 * Limb mode of ADD/SUB against bit-serial, operands up to thousands of bits
+	 */
+	{
+		enum {
+			SLOT = 8192, // bits reserved per operand/result
+		};
+
+		unsigned char *pLimb = (unsigned char *) calloc(4 * SLOT / 8 + 16, 1);
+		INBIT<RUNN> lL(pLimb), lR(pLimb), lib(pLimb);
+		OUTBIT<RUNN> lob(pLimb);
+
+		// compare encodings, not only values
+		alu.native = false;
+
+		for (unsigned round = 0; round < 200; round++) {
+			unsigned iL = round & 7, iR = SLOT + (round * 3 & 7), iSerial = 2 * SLOT + (round * 5 & 7), iLimb = 3 * SLOT;
+
+			// random payloads, long or short, both polarities
+			for (unsigned k = 0; k < 2; k++) {
+				unsigned length = xorshift64() % ((round & 1) ? 3000 : 120);
+				bool polarity = xorshift64() & 1;
+				uint64_t rnd = 0;
+
+				lob.start(k ? iR : iL);
+				for (unsigned j = 0; j < length; j++) {
+					if (!(j & 63))
+						rnd = xorshift64();
+					// also long runs of same polarity
+					lob.emitbit((round & 2) ? polarity ^ (j % 67 == 0) : (rnd >> (j & 63)) & 1);
+				}
+				lob.emitEOSS(polarity);
+				lob.emitraw(polarity);
+				lob.flush();
+			}
+
+			for (unsigned op = 0; op < 2; op++) {
+				// bit-serial reference
+				alu.limbs = false;
+				if (!op)
+					alu.ADD(lob, iSerial, lL, iL, lR, iR);
+				else
+					alu.SUB(lob, iSerial, lL, iL, lR, iR);
+				unsigned state = lL.state | lR.state, bit = lL.bit << 1 | lR.bit, endL = lL.getpos(), endR = lR.getpos();
+				unsigned length = lib.encodedLength(iSerial);
+
+				// each kernel decodes chunks differently
+				alu.limbs = true;
+				for (unsigned k = 0; k < numKernels; k++) {
+					if (!kernelSelect(kernels[k].name))
+						continue; // not supported
+
+					if (!op)
+						alu.ADD(lob, iLimb, lL, iL, lR, iR);
+					else
+						alu.SUB(lob, iLimb, lL, iL, lR, iR);
+
+					if (lib.encodedLength(iLimb) != length || !rawequal(pLimb, iSerial, pLimb, iLimb, length)
+						|| (lL.state | lR.state) != state || (unsigned) (lL.bit << 1 | lR.bit) != bit || lL.getpos() != endL || lR.getpos() != endR) {
+						fprintf(stderr, "kernel %s limb error. round=%u op=%u\n", kernels[kernelIndex].name, round, op);
+						return 1;
+					}
+				}
+				kernelIndex = startup;
+			}
 		}
+		alu.native = true;
+
+		free(pLimb);
 	}
 
 	/*
-	 * Test that the encoded value has smallest storage.
-	 * This is done by filling memory with quasi random bits, decoding+encoding, testing the size of representation being less-equal to the original
+	 * Bit-sliced batches against the bit-serial operators, operands of random length spanning several blocks
 	 */
-	for (int polarity = 0; polarity < 2; polarity++) {
-		for (int64_t num = 0x0000; num <= 0xffff; num++) {
-			// setup memory
-			mem[0] = num;
-			mem[1] = (num >> 8);
-			if (polarity)
-				mem[2] = mem[3] = 0xff;
-			else
-				mem[2] = mem[3] = 0x00;
-
-			// which bit is not part of the leading polarity
-			int lengthDecode = 0;
-			for (lengthDecode = 31; lengthDecode >= 0; --lengthDecode) {
-				if (((mem[lengthDecode / 8] >> (lengthDecode % 8)) & 1) != polarity)
-					break;
+	{
+		enum {
+			numOps = 200,
+			SLOT = 512, // bits reserved per operand/result
+		};
+
+		unsigned char *pIn = (unsigned char *) calloc(2 * numOps * SLOT / 8 + 16, 1);
+		unsigned char *pSerial = (unsigned char *) calloc(numOps * SLOT / 8 + 16, 1);
+		unsigned char *pSliced = (unsigned char *) calloc(numOps * SLOT / 8 + 16, 1);
+		unsigned posL[numOps], posR[numOps], posOut[numOps];
+
+		INBIT<RUNN> sL(pIn), sR(pIn), sib(pSerial);
+		OUTBIT<RUNN> sob(pIn), serialOut(pSerial), slicedOut(pSliced);
+		SLICEALU<RUNN> salu;
+
+		for (unsigned i = 0; i < numOps; i++) {
+			posL[i] = (2 * i) * SLOT + (i & 7);
+			posR[i] = (2 * i + 1) * SLOT + (i * 3 & 7);
+			posOut[i] = i * SLOT + (i * 5 & 7);
+
+			// random payload of 0-150 bits, every 8th operand short
+			for (unsigned k = 0; k < 2; k++) {
+				unsigned length = (i & 7) ? xorshift64() % 151 : xorshift64() % 4;
+				bool polarity = xorshift64() & 1;
+
+				sob.start(k ? posR[i] : posL[i]);
+				for (unsigned j = 0; j < length; j++)
+					sob.emitbit(xorshift64() & 1);
+				sob.emitEOSS(polarity);
+				sob.emitraw(polarity);
+				sob.flush();
 			}
+		}
 
-			// decode value
-			int64_t n;
-			n = ib.decode(0);
+		// compare encodings, not only values
+		alu.native = false;
+
+		for (unsigned op = 0; op < 5; op++) {
+			for (unsigned i = 0; i < numOps; i++) {
+				switch (op) {
+				case 0: alu.ADD(serialOut, posOut[i], sL, posL[i], sR, posR[i]); break;
+				case 1: alu.SUB(serialOut, posOut[i], sL, posL[i], sR, posR[i]); break;
+				case 2: alu.AND(serialOut, posOut[i], sL, posL[i], sR, posR[i]); break;
+				case 3: alu.XOR(serialOut, posOut[i], sL, posL[i], sR, posR[i]); break;
+				case 4: alu.OR(serialOut, posOut[i], sL, posL[i], sR, posR[i]); break;
+				}
+			}
 
-			// encode it again after presetting all bits of destination
-			if (polarity)
-				mem[0] = mem[1] = 0xff;
-			else
-				mem[0] = mem[1] = 0x00;
-			ob.encode(0, n);
+			// also less operations than lanes of `SLICEALU`, and single operations
+			static const unsigned counts[] = {0, 1, 2, 3, 37, numOps};
+			for (unsigned n : counts) {
+				memset(pSliced, 0, numOps * SLOT / 8 + 16);
+
+				switch (op) {
+				case 0: salu.ADD(slicedOut, posOut, sL, posL, sR, posR, n); break;
+				case 1: salu.SUB(slicedOut, posOut, sL, posL, sR, posR, n); break;
+				case 2: salu.AND(slicedOut, posOut, sL, posL, sR, posR, n); break;
+				case 3: salu.XOR(slicedOut, posOut, sL, posL, sR, posR, n); break;
+				case 4: salu.OR(slicedOut, posOut, sL, posL, sR, posR, n); break;
+				}
 
-			// which bit is not part of the leading polarity
-			int lengthEncode = 0;
-			for (lengthEncode = 31; lengthEncode >= 0; --lengthEncode) {
-				if (((mem[lengthEncode / 8] >> (lengthEncode % 8)) & 1) != polarity)
-					break;
+				for (unsigned i = 0; i < n; i++) {
+					unsigned length = sib.encodedLength(posOut[i]);
+					if (!rawequal(pSerial, posOut[i], pSliced, posOut[i], length)) {
+						fprintf(stderr, "SLICEALU error. op=%u n=%u i=%u\n", op, n, i);
+						return 1;
+					}
+				}
 			}
 
-			// encode may not be longer than what was decoded
-			if (lengthEncode > lengthDecode) {
-				fprintf(stderr, "decode/encode length error. mem=%02x.%02x.%02x.%02x num=%ld lengthDecode=%d lengthEncode=%d\n",
-					mem[3], mem[2], ((unsigned) num >> 8) & 0xff, (unsigned) num & 0xff, n, lengthDecode, lengthEncode);
-				return 1;
+			// results packed back to back, lanes share first and last bytes, queue in address order and reversed
+			for (unsigned reversed = 0; reversed < 2; reversed++) {
+				unsigned posPacked[numOps];
+				unsigned packed = 3;
+				for (unsigned k = 0; k < numOps; k++) {
+					unsigned i = reversed ? numOps - 1 - k : k;
+					posPacked[i] = packed;
+					packed += sib.encodedLength(posOut[i]);
+				}
+
+				memset(pSliced, 0, numOps * SLOT / 8 + 16);
+
+				switch (op) {
+				case 0: salu.ADD(slicedOut, posPacked, sL, posL, sR, posR, numOps); break;
+				case 1: salu.SUB(slicedOut, posPacked, sL, posL, sR, posR, numOps); break;
+				case 2: salu.AND(slicedOut, posPacked, sL, posL, sR, posR, numOps); break;
+				case 3: salu.XOR(slicedOut, posPacked, sL, posL, sR, posR, numOps); break;
+				case 4: salu.OR(slicedOut, posPacked, sL, posL, sR, posR, numOps); break;
+				}
+
+				for (unsigned i = 0; i < numOps; i++) {
+					unsigned length = sib.encodedLength(posOut[i]);
+					if (!rawequal(pSerial, posOut[i], pSliced, posPacked[i], length)) {
+						fprintf(stderr, "SLICEALU packed error. op=%u reversed=%u i=%u\n", op, reversed, i);
+						return 1;
+					}
+				}
 			}
 		}
+
+		alu.native = true;
+
+		free(pIn);
+		free(pSerial);
+		free(pSliced);
 	}
 
 	/*
-	 * Test all the basic operators
+	 * Test all the unsigned operators, single thread, range capped at 12 bits
 	 */
-	struct ALU alu;
+	UALU<RUNN> ualu;
+	unsigned ualuBits = aluBits < 12 ? aluBits : 12;
 
-	for (unsigned round = 0; round < 10; round++) {
+	for (unsigned round = 3; round < 10; round++) {
 		// display round
 		// @formatter:off
 		switch (round) {
-		case 0: continue; fputs("MUL\n", stdout); break;
-		case 1: continue; fputs("DIV\n", stdout); break;
-		case 2: continue; fputs("MOD\n", stdout); break;
-		case 3: fputs("ADD\n", stdout); break;
-		case 4: fputs("SUB\n", stdout); break;
-		case 5: fputs("LSL\n", stdout); break;
-		case 6: fputs("LSR\n", stdout); break;
-		case 7: fputs("AND\n", stdout); break;
-		case 8: fputs("XOR\n", stdout); break;
-		case 9: fputs("OR\n", stdout); break;
+		case 3: fputs("UADD\n", stdout); break;
+		case 4: fputs("USUB\n", stdout); break;
+		case 5: fputs("ULSL\n", stdout); break;
+		case 6: fputs("ULSR\n", stdout); break;
+		case 7: fputs("UAND\n", stdout); break;
+		case 8: fputs("UXOR\n", stdout); break;
+		case 9: fputs("UOR\n", stdout); break;
 		}
 		// @formatter:on
 
-		int progress = 0;
-		for (int64_t lval = -(1 << 12); lval <= +(1 << 12); lval++) {
-			for (int64_t rval = -(1 << 12); rval <= +(1 << 12); rval++) {
-				// ticker
-				progress++;
-				if (tick) {
-					fprintf(stderr, "\r\e[K%.2f%%", progress * 100.0 / (4.0 * (1 << 12) * (1 << 12)));
-					tick = 0;
-				}
-
+		for (uint64_t lval = 0; lval <= (1U << ualuBits); lval++) {
+			for (uint64_t rval = 0; rval <= (1U << ualuBits); rval++) {
 				// rewind memory
 				pos = 0;
 
 				// encode <left>
 				unsigned iL = pos;
-				ob.encode(pos, lval);
-				pos = ob.getpos();
+				uob.encode(pos, lval);
+				pos = uob.getpos();
 
 				// encode <right>
 				unsigned iR = pos;
-				ob.encode(pos, rval);
-				pos = ob.getpos();
+				uob.encode(pos, rval);
+				pos = uob.getpos();
 
 				// perform opcode and evaluate native
 				unsigned iOpcode = pos;
-				int64_t expected = 0;
+				uint64_t expected = 0;
 				switch (round) {
-				case 0:
-//					pos = MUL(mem, pos, mem, iL, mem, iR);
-					expected = lval + rval;
-					break;
-				case 1:
-//					pos = DIV(mem, pos, mem, iL, mem, iR);
-					expected = lval + rval;
-					break;
-				case 2:
-//					pos = MOD(mem, pos, mem, iL, mem, iR);
-					expected = lval + rval;
-					break;
 				case 3:
-					alu.ADD(ob, pos, L, iL, R, iR);
-					pos = ob.getpos();
+					ualu.ADD(uob, pos, UL, iL, UR, iR);
 					expected = lval + rval;
 					break;
 				case 4:
-					alu.SUB(ob, pos, L, iL, R, iR);
-					pos = ob.getpos();
+					if (ualu.SUB(uob, pos, UL, iL, UR, iR) != (lval < rval)) {
+						fprintf(stderr, "borrow error 0x%lx USUB 0x%lx\n", lval, rval);
+						return 1;
+					}
+					if (lval < rval)
+						continue; // result wraps
 					expected = lval - rval;
 					break;
 				case 5:
-					if (rval < 0 || rval > 20)
+					if (rval > 20)
 						continue; // limit range
-					alu.LSL(ob, pos, L, iL, R, iR);
-					pos = ob.getpos();
+					ualu.LSL(uob, pos, UL, iL, UR, iR);
 					expected = lval << rval;
 					break;
 				case 6:
-					if (rval < 0 || rval > 20)
+					if (rval > 20)
 						continue; // limit range
-					alu.LSR(ob, pos, L, iL, R, iR);
-					pos = ob.getpos();
+					ualu.LSR(uob, pos, UL, iL, UR, iR);
 					expected = lval >> rval;
 					break;
 				case 7:
-					alu.AND(ob, pos, L, iL, R, iR);
-					pos = ob.getpos();
+					ualu.AND(uob, pos, UL, iL, UR, iR);
 					expected = lval & rval;
 					break;
 				case 8:
-					alu.XOR(ob, pos, L, iL, R, iR);
-					pos = ob.getpos();
+					ualu.XOR(uob, pos, UL, iL, UR, iR);
 					expected = lval ^ rval;
 					break;
 				case 9:
-					alu.OR(ob, pos, L, iL, R, iR);
-					pos = ob.getpos();
+					ualu.OR(uob, pos, UL, iL, UR, iR);
 					expected = lval | rval;
 					break;
 				};
 
-				// extract
-				int64_t answer;
-				answer = ib.decode(iOpcode);
-
-				/*
-				 * Compare
-				 */
+				// extract and compare
+				uint64_t answer = uib.decode(iOpcode);
 				if (answer != expected) {
-					fprintf(stderr, "result error 0x%lx OPCODE 0x%lx. Expected=0x%lx Encountered 0x%lx\n", lval, rval, expected, answer);
+					fprintf(stderr, "result error 0x%lx UOPCODE 0x%lx. Expected=0x%lx Encountered 0x%lx\n", lval, rval, expected, answer);
 					return 1;
 				}
+			}
+		}
+	}
 
-				if (0) {
-					// encode answer to determine length
-					unsigned iAnswer = pos;
-					ob.encode(pos, answer);
-					pos = ob.getpos();
+	return 0;
+}
 
-					// display encoded answer
-					for (unsigned k = iOpcode; k < iAnswer; k++) {
-						ib.start(k);
-						ib.nextbit();
-						putchar(ib.bit ? '1' : '0');
-					}
-					putchar('\n');
+/*
+ * @date 2026-10-17 00:41:12
+ *
+ * `srunbench.cc` includes this file for the engine and has its own `main()`
+ */
+#if !defined(SRUNBENCH)
+int main(int argc, char *argv[]) {
+	setlinebuf(stdout);
+	signal(SIGALRM, sigAlarm);
+	alarm(1);
 
-				}
-			}
+	long numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned aluBits = 12;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "j:r:")) != -1) {
+		switch (opt) {
+		case 'j':
+			numThreads = strtol(optarg, NULL, 10);
+			break;
+		case 'r':
+			aluBits = strtoul(optarg, NULL, 10);
+			break;
+		default:
+			numThreads = 0;
+			break;
 		}
-		fprintf(stderr, "\r\e[K");
 	}
+	if (numThreads < 1 || numThreads > 1024 || aluBits < 1 || aluBits > 20 || optind != argc) {
+		fprintf(stderr, "usage: %s [-j <threads>] [-r <bits>]\n"
+			"\t-j <threads>\tthreads of the exhaustive operator test, default number of processors\n"
+			"\t-r <bits>\toperands of the exhaustive operator test range from -2^bits to +2^bits, default 12, up to 20\n", argv[0]);
+		return 1;
+	}
+
+	// default runlength exhaustive, others sampled
+	if (selftest<3>(aluBits, numThreads))
+		return 1;
+	if (selftest<2>(8, numThreads) || selftest<4>(8, numThreads) || selftest<5>(8, numThreads))
+		return 1;
 
 	return 0;
 }
+#endif
@@ -0,0 +1,738 @@
+/*
+ * srunbench.cc
+ *
+ * @date 2026-10-17 00:41:12
+ *
+ * Benchmark of `OUTBIT::encode()`, `INBIT::decode()` and the `ALU` operators for each runlength, 2 to 8.
+ * Results are written to stdout as JSON, to track regressions between releases.
+ *
+ * Datasets:
+ *   small - uniform in -128..+127
+ *   zipf  - magnitudes 0..65535 with Zipf distribution (s=1), random sign
+ *   wide  - random 64-bit values shifted right by a random amount, all widths
+ *   runs  - runs of exactly RUNN identical bits, every run needs an escape
+ *
+ * Encode is measured per encoded bit written, decode and the operators per encoded bit of the operands read.
+ * The operators run on consecutive pairs of the dataset, `LSL`/`LSR` with the right-hand-side limited to 0..31.
+ * Each measurement is the best of a number of runs.
+ *
+ * @date 2026-10-17 01:02:27
+ *
+ * Reference codecs run on the same values: LEB128 of zigzag, Elias gamma and Elias delta of zigzag+1,
+ * and fixed-width two's complement as wide as the widest value of the dataset.
+ * Size and encode/decode throughput of all codecs are also listed side by side on stderr.
+ *
+ * @date 2026-10-17 01:47:19
+ *
+ * Sweep of the `BIGMUL` Karatsuba and Toom-3 thresholds, schoolbook/Karatsuba/Toom-3 on 4 to 2048 limbs.
+ */
+
+/*
+ *	This file is part of Armonika,
+ *	Encoding/decoding/handling of variable length numbers in bit addressable memory.
+ *	Copyright (C) 2020, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <time.h>
+
+// the engine, without the selftest `main()`
+#define SRUNBENCH
+#include "srun3.cc"
+
+enum {
+	DATASET_SMALL, DATASET_ZIPF, DATASET_WIDE, DATASET_RUNS, NUMDATASETS
+};
+
+const char *datasetNames[NUMDATASETS] = {"small", "zipf", "wide", "runs"};
+
+unsigned numResults = 0; // results written, for the separating comma
+
+/*
+ * @date 2026-10-17 00:41:12
+ *
+ * Monotonic time in seconds
+ */
+double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*
+ * @date 2026-10-17 00:41:12
+ *
+ * Write one result as JSON object
+ *
+ * @param {string} pCodec - `srun` or name of reference codec
+ * @param {number} runn - runlength, of the dataset for reference codecs
+ * @param {string} pDataset - name of dataset
+ * @param {string} pOp - name of measured operation
+ * @param {string} pMode - `ALU` mode, `default` or `serial`
+ * @param {number} values - number of values (or operand pairs) processed
+ * @param {number} bits - number of encoded bits written (encode) or read
+ * @param {number} seconds - best time of all runs
+ */
+void result(const char *pCodec, unsigned runn, const char *pDataset, const char *pOp, const char *pMode, uint64_t values, uint64_t bits, double seconds) {
+	printf("%s\n    {\"codec\": \"%s\", \"runn\": %u, \"dataset\": \"%s\", \"op\": \"%s\", \"mode\": \"%s\", \"values\": %lu, \"bits\": %lu, \"bits_per_value\": %.3f, \"seconds\": %.6f, \"ns_per_bit\": %.3f, \"values_per_s\": %.0f}",
+	       numResults++ ? "," : "", pCodec, runn, pDataset, pOp, pMode, values, bits, (double) bits / values, seconds, seconds * 1e9 / bits, values / seconds);
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Side by side comparison of codecs on stderr, size and throughput of encode and decode
+ */
+void summary(const char *pCodec, unsigned runn, const char *pDataset, uint64_t values, uint64_t bits, double encodeSeconds, double decodeSeconds) {
+	fprintf(stderr, "RUNN=%u %-6s %-7s %7.2f bits/value  encode %7.1f M/s  decode %7.1f M/s\n",
+		runn, pDataset, pCodec, (double) bits / values, values / encodeSeconds * 1e-6, values / decodeSeconds * 1e-6);
+}
+
+/*
+ * @date 2026-10-17 00:41:12
+ *
+ * Uniform quasi random number in [0,1)
+ */
+double uniform(void) {
+	return (xorshift64() >> 11) * (1.0 / (1ULL << 53));
+}
+
+/*
+ * @date 2026-10-17 00:41:12
+ *
+ * Fill dataset
+ *
+ * @param {number} runn - runlength, for `runs`
+ * @param {number} dataset - `DATASET_*`
+ * @param {int64_t[]} pValues - values
+ * @param {number} n - number of values
+ */
+void generate(unsigned runn, unsigned dataset, int64_t *pValues, unsigned n) {
+	enum {
+		ZIPFMAX = 65536, // magnitudes of `zipf`
+	};
+	static double *pCdf = NULL; // cumulative distribution of `zipf`
+
+	if (dataset == DATASET_ZIPF && !pCdf) {
+		pCdf = (double *) malloc(ZIPFMAX * sizeof *pCdf);
+		if (!pCdf) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+
+		double sum = 0;
+		for (unsigned k = 0; k < ZIPFMAX; k++)
+			pCdf[k] = sum += 1.0 / (k + 1);
+		for (unsigned k = 0; k < ZIPFMAX; k++)
+			pCdf[k] /= sum;
+	}
+
+	for (unsigned i = 0; i < n; i++) {
+		switch (dataset) {
+		case DATASET_SMALL:
+			pValues[i] = (int64_t) (xorshift64() & 255) - 128;
+			break;
+		case DATASET_ZIPF: {
+			// first magnitude with cumulative probability above `u`
+			double u = uniform();
+			unsigned lo = 0, hi = ZIPFMAX - 1;
+			while (lo < hi) {
+				unsigned mid = (lo + hi) / 2;
+				if (pCdf[mid] > u)
+					hi = mid;
+				else
+					lo = mid + 1;
+			}
+			pValues[i] = xorshift64() & 1 ? -(int64_t) lo : lo;
+			break;
+		}
+		case DATASET_WIDE: {
+			int64_t num = xorshift64();
+			pValues[i] = num >> (xorshift64() & 63);
+			break;
+		}
+		case DATASET_RUNS: {
+			// alternating runs of RUNN bits up to a random width, sign extended
+			unsigned width = 8 + xorshift64() % 56;
+			uint64_t bit = xorshift64() & 1, num = 0;
+			for (unsigned j = 0; j < width; j++) {
+				if (j % runn == 0)
+					bit ^= 1;
+				num |= bit << j;
+			}
+			pValues[i] = (int64_t) (num << (64 - width)) >> (64 - width);
+			break;
+		}
+		}
+	}
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Append `count` bits LSB first, `count` up to 57. Memory must be zeroed.
+ */
+static inline void putbits(unsigned char *pBase, uint64_t &pos, uint64_t bits, unsigned count) {
+	uint64_t word;
+	memcpy(&word, pBase + pos / 8, sizeof word);
+	word |= bits << (pos & 7);
+	memcpy(pBase + pos / 8, &word, sizeof word);
+	pos += count;
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Read `count` bits LSB first, `count` up to 57
+ */
+static inline uint64_t getbits(const unsigned char *pBase, uint64_t &pos, unsigned count) {
+	uint64_t word;
+	memcpy(&word, pBase + pos / 8, sizeof word);
+	word >>= pos & 7;
+	pos += count;
+	return count < 64 ? word & ((1ULL << count) - 1) : word;
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Append/read up to 64 bits in two parts
+ */
+static inline void putwide(unsigned char *pBase, uint64_t &pos, uint64_t bits, unsigned count) {
+	if (count > 32) {
+		putbits(pBase, pos, bits & 0xffffffff, 32);
+		putbits(pBase, pos, bits >> 32, count - 32);
+	} else {
+		putbits(pBase, pos, bits, count);
+	}
+}
+
+static inline uint64_t getwide(const unsigned char *pBase, uint64_t &pos, unsigned count) {
+	if (count > 32) {
+		uint64_t lo = getbits(pBase, pos, 32);
+		return lo | getbits(pBase, pos, count - 32) << 32;
+	}
+	return getbits(pBase, pos, count);
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Zigzag, `0, -1, +1, -2, +2 ...` to `0, 1, 2, 3, 4 ...`
+ */
+static inline uint64_t zigzag(int64_t num) {
+	return (uint64_t) num << 1 ^ (uint64_t) (num >> 63);
+}
+
+static inline int64_t unzigzag(uint64_t num) {
+	return (int64_t) (num >> 1) ^ -(int64_t) (num & 1);
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * LEB128 of zigzag, 7 bits per byte, high bit set when more follow.
+ * Byte aligned, `pos` is a multiple of 8.
+ */
+uint64_t leb128Encode(unsigned char *pBase, uint64_t pos, int64_t num, unsigned) {
+	uint64_t u = zigzag(num);
+	unsigned char *p = pBase + pos / 8;
+
+	while (u >= 0x80) {
+		*p++ = u | 0x80;
+		u >>= 7;
+	}
+	*p++ = u;
+	return (p - pBase) * 8ULL;
+}
+
+int64_t leb128Decode(const unsigned char *pBase, uint64_t &pos, unsigned) {
+	const unsigned char *p = pBase + pos / 8;
+	uint64_t u = 0;
+	unsigned shift = 0;
+
+	while (*p & 0x80) {
+		u |= (uint64_t) (*p++ & 0x7f) << shift;
+		shift += 7;
+	}
+	u |= (uint64_t) *p++ << shift;
+	pos = (p - pBase) * 8ULL;
+	return unzigzag(u);
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Elias gamma of `n = zigzag + 1`: `N-1` zeros, a one, the `N-1` bits of `n` below its leading one.
+ * The stream is LSB first, the code lengths are those of the textbook MSB first form.
+ * `zigzag(INT64_MIN) + 1` wraps to 0, it is coded as `n = 2^64`.
+ */
+uint64_t gammaEncode(unsigned char *pBase, uint64_t pos, int64_t num, unsigned) {
+	uint64_t n = zigzag(num) + 1;
+	unsigned z = n ? 63 - __builtin_clzll(n) : 64;
+
+	pos += z; // zeros
+	putbits(pBase, pos, 1, 1);
+	putwide(pBase, pos, z < 64 ? n & ((1ULL << z) - 1) : 0, z);
+	return pos;
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Count zeros up to the next one
+ */
+static inline unsigned getzeros(const unsigned char *pBase, uint64_t &pos) {
+	unsigned z = 0;
+	for (;;) {
+		uint64_t word = getbits(pBase, pos, 56);
+		if (word) {
+			unsigned k = __builtin_ctzll(word);
+			pos = pos - 56 + k + 1;
+			return z + k;
+		}
+		z += 56;
+	}
+}
+
+int64_t gammaDecode(const unsigned char *pBase, uint64_t &pos, unsigned) {
+	unsigned z = getzeros(pBase, pos);
+	uint64_t n = (z < 64 ? 1ULL << z : 0) | getwide(pBase, pos, z);
+	return unzigzag(n - 1);
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Elias delta of `n = zigzag + 1`: the length `N` of `n` in Elias gamma, then the `N-1` bits of `n` below its leading one
+ */
+uint64_t deltaEncode(unsigned char *pBase, uint64_t pos, int64_t num, unsigned) {
+	uint64_t n = zigzag(num) + 1;
+	unsigned z = n ? 63 - __builtin_clzll(n) : 64;
+	unsigned N = z + 1;
+	unsigned zN = 31 - __builtin_clz(N);
+
+	pos += zN;
+	putbits(pBase, pos, 1, 1);
+	putbits(pBase, pos, N & ((1U << zN) - 1), zN);
+	putwide(pBase, pos, z < 64 ? n & ((1ULL << z) - 1) : 0, z);
+	return pos;
+}
+
+int64_t deltaDecode(const unsigned char *pBase, uint64_t &pos, unsigned) {
+	unsigned zN = getzeros(pBase, pos);
+	unsigned z = (1U << zN | getbits(pBase, pos, zN)) - 1;
+	uint64_t n = (z < 64 ? 1ULL << z : 0) | getwide(pBase, pos, z);
+	return unzigzag(n - 1);
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Fixed-width two's complement, `width` is the widest value of the dataset
+ */
+uint64_t fixedEncode(unsigned char *pBase, uint64_t pos, int64_t num, unsigned width) {
+	putwide(pBase, pos, width < 64 ? num & ((1ULL << width) - 1) : num, width);
+	return pos;
+}
+
+int64_t fixedDecode(const unsigned char *pBase, uint64_t &pos, unsigned width) {
+	uint64_t num = getwide(pBase, pos, width);
+	return (int64_t) (num << (64 - width)) >> (64 - width);
+}
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Reference codec
+ */
+struct CODEC {
+	const char *name;
+	uint64_t (*encode)(unsigned char *pBase, uint64_t pos, int64_t num, unsigned width); // return position following value
+	int64_t (*decode)(const unsigned char *pBase, uint64_t &pos, unsigned width);       // advance `pos` past value
+};
+
+const CODEC codecs[] = {
+	{"leb128", leb128Encode, leb128Decode},
+	{"gamma",  gammaEncode,  gammaDecode},
+	{"delta",  deltaEncode,  deltaDecode},
+	{"fixed",  fixedEncode,  fixedDecode},
+};
+
+/*
+ * @date 2026-10-17 01:02:27
+ *
+ * Measure reference codec on dataset, best of `runs`
+ *
+ * @param {CODEC} codec - codec
+ * @param {number} runn - runlength of dataset
+ * @param {string} pDataset - name of dataset
+ * @param {int64_t[]} pValues - values
+ * @param {number} n - number of values
+ * @param {number} runs - number of runs per measurement
+ * @param {unsigned char[]} pBase - memory of 160 bits per value
+ * @return {number} - 0 on success
+ */
+int measure(const CODEC &codec, unsigned runn, const char *pDataset, const int64_t *pValues, unsigned n, unsigned runs, unsigned char *pBase) {
+	// two's complement width of widest value
+	unsigned width = 1;
+	for (unsigned i = 0; i < n; i++) {
+		unsigned w = 64 - __builtin_clrsbll(pValues[i]);
+		if (w > width)
+			width = w;
+	}
+
+	double bestEncode = 0, bestDecode = 0;
+	uint64_t bits = 0;
+	for (unsigned run = 0; run < runs; run++) {
+		memset(pBase, 0, (uint64_t) n * 160 / 8 + 16);
+
+		double start = now();
+		uint64_t pos = 0;
+		for (unsigned i = 0; i < n; i++)
+			pos = codec.encode(pBase, pos, pValues[i], width);
+		double elapsed = now() - start;
+		if (!run || elapsed < bestEncode)
+			bestEncode = elapsed;
+		bits = pos;
+
+		start = now();
+		pos = 0;
+		uint64_t sum = 0;
+		for (unsigned i = 0; i < n; i++)
+			sum += codec.decode(pBase, pos, width);
+		elapsed = now() - start;
+		if (!run || elapsed < bestDecode)
+			bestDecode = elapsed;
+
+		uint64_t expected = 0;
+		for (unsigned i = 0; i < n; i++)
+			expected += pValues[i];
+		if (sum != expected || pos != bits) {
+			fprintf(stderr, "%s decode error. dataset=%s\n", codec.name, pDataset);
+			return 1;
+		}
+	}
+
+	result(codec.name, runn, pDataset, "encode", "default", n, bits, bestEncode);
+	result(codec.name, runn, pDataset, "decode", "default", n, bits, bestDecode);
+	summary(codec.name, runn, pDataset, n, bits, bestEncode, bestDecode);
+	return 0;
+}
+
+/*
+ * @date 2026-10-17 00:41:12
+ *
+ * Operator under test
+ */
+template<unsigned RUNN>
+struct OPERATOR {
+	const char *name;
+	void (ALU<RUNN>::*op)(OUTBIT<RUNN> &out, unsigned iOut, INBIT<RUNN> &L, unsigned iL, INBIT<RUNN> &R, unsigned iR);
+	bool shift; // right-hand-side is a shift count
+};
+
+/*
+ * @date 2026-10-17 00:41:12
+ *
+ * Benchmark runlength `RUNN`
+ *
+ * @param {number} n - number of values per dataset
+ * @param {number} runs - number of runs per measurement, the best counts
+ * @return {number} - 0 on success
+ */
+template<unsigned RUNN>
+int bench(unsigned n, unsigned runs) {
+	static const OPERATOR<RUNN> operators[] = {
+		{"ADD", &ALU<RUNN>::ADD, false},
+		{"SUB", &ALU<RUNN>::SUB, false},
+		{"MUL", &ALU<RUNN>::MUL, false},
+		{"DIV", &ALU<RUNN>::DIV, false},
+		{"MOD", &ALU<RUNN>::MOD, false},
+		{"LSL", &ALU<RUNN>::LSL, true},
+		{"LSR", &ALU<RUNN>::LSR, true},
+		{"AND", &ALU<RUNN>::AND, false},
+		{"XOR", &ALU<RUNN>::XOR, false},
+		{"OR",  &ALU<RUNN>::OR,  false},
+	};
+
+	// room for escapes of twice the data bits, products have twice the data bits
+	int64_t *pValues = (int64_t *) malloc(n * sizeof *pValues);
+	unsigned *pPos = (unsigned *) malloc((n + 1) * sizeof *pPos);
+	unsigned *pShiftPos = (unsigned *) malloc((n + 1) * sizeof *pShiftPos);
+	unsigned char *pIn = (unsigned char *) calloc((uint64_t) n * 160 / 8 + 16, 1);
+	unsigned char *pShift = (unsigned char *) calloc((uint64_t) n * 32 / 8 + 16, 1);
+	unsigned char *pOut = (unsigned char *) calloc((uint64_t) n * 512 / 8 + 16, 1);
+	if (!pValues || !pPos || !pShiftPos || !pIn || !pShift || !pOut) {
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+
+	OUTBIT<RUNN> ob(pIn), sob(pShift), oob(pOut);
+	INBIT<RUNN> ib(pIn), L(pIn), R(pIn), S(pShift);
+	ALU<RUNN> alu;
+
+	for (unsigned dataset = 0; dataset < NUMDATASETS; dataset++) {
+		const char *pName = datasetNames[dataset];
+		generate(RUNN, dataset, pValues, n);
+
+		// encode
+		double best = 0, bestEncode;
+		for (unsigned run = 0; run < runs; run++) {
+			double start = now();
+			unsigned pos = 0;
+			for (unsigned i = 0; i < n; i++) {
+				pPos[i] = pos;
+				ob.encode(pos, pValues[i]);
+				pos = ob.getpos();
+			}
+			pPos[n] = pos;
+			double elapsed = now() - start;
+			if (!run || elapsed < best)
+				best = elapsed;
+		}
+		result("srun", RUNN, pName, "encode", "default", n, pPos[n], best);
+		bestEncode = best;
+
+		// decode
+		for (unsigned run = 0; run < runs; run++) {
+			double start = now();
+			unsigned pos = 0;
+			uint64_t sum = 0;
+			for (unsigned i = 0; i < n; i++) {
+				sum += ib.decode(pos);
+				pos = ib.getpos();
+			}
+			double elapsed = now() - start;
+			if (!run || elapsed < best)
+				best = elapsed;
+
+			// also keeps the loop from being optimised away
+			uint64_t expected = 0;
+			for (unsigned i = 0; i < n; i++)
+				expected += pValues[i];
+			if (sum != expected || pos != pPos[n]) {
+				fprintf(stderr, "decode error. RUNN=%u dataset=%s\n", RUNN, pName);
+				return 1;
+			}
+		}
+		result("srun", RUNN, pName, "decode", "default", n, pPos[n], best);
+		summary("srun", RUNN, pName, n, pPos[n], bestEncode, best);
+
+		// reference codecs on the same values
+		for (const CODEC &codec : codecs) {
+			if (measure(codec, RUNN, pName, pValues, n, runs, pOut))
+				return 1;
+		}
+
+		// shift counts
+		unsigned pos = 0;
+		for (unsigned i = 0; i < n; i++) {
+			pShiftPos[i] = pos;
+			sob.encode(pos, pValues[i] & 31);
+			pos = sob.getpos();
+		}
+		pShiftPos[n] = pos;
+
+		// operators on consecutive pairs, all fast paths enabled and bit-serial
+		for (unsigned mode = 0; mode < 2; mode++) {
+			alu.native = mode == 0;
+			alu.limbs = mode == 0;
+
+			for (const OPERATOR<RUNN> &o : operators) {
+				INBIT<RUNN> &right = o.shift ? S : R;
+				const unsigned *pRight = o.shift ? pShiftPos : pPos + 1;
+				uint64_t bits = (pPos[n - 1] - pPos[0]) + (pRight[n - 1] - pRight[0]);
+
+				for (unsigned run = 0; run < runs; run++) {
+					double start = now();
+					unsigned pos = 0;
+					for (unsigned i = 0; i + 1 < n; i++) {
+						(alu.*o.op)(oob, pos, L, pPos[i], right, pRight[i]);
+						pos = oob.getpos();
+					}
+					double elapsed = now() - start;
+					if (!run || elapsed < best)
+						best = elapsed;
+				}
+				result("srun", RUNN, pName, o.name, mode ? "serial" : "default", n - 1, bits, best);
+			}
+		}
+	}
+
+	free(pValues);
+	free(pPos);
+	free(pShiftPos);
+	free(pIn);
+	free(pShift);
+	free(pOut);
+	return 0;
+}
+
+/*
+ * @date 2026-10-17 01:47:19
+ *
+ * Time `method` on `n` limbs, best of `runs`, seconds per multiply
+ */
+double timeMul(BIGMUL &mul, unsigned method, uint64_t *pR, const uint64_t *pA, const uint64_t *pB, unsigned n, unsigned runs) {
+	// about 2^24 limb products per run
+	unsigned reps = (1U << 24) / (n * n) + 1;
+
+	double best = 0;
+	for (unsigned run = 0; run < runs; run++) {
+		double start = now();
+		for (unsigned r = 0; r < reps; r++) {
+			switch (method) {
+			case 0: mul.schoolbook(pR, pA, n, pB, n); break;
+			case 1: mul.karatsuba(pR, pA, pB, n); break;
+			case 2: mul.toom3(pR, pA, pB, n); break;
+			}
+		}
+		double elapsed = now() - start;
+		if (!run || elapsed < best)
+			best = elapsed;
+	}
+	return best / reps;
+}
+
+/*
+ * @date 2026-10-17 01:47:19
+ *
+ * Sweep of `BIGMUL` thresholds.
+ *
+ * For operands of 4 to 2048 limbs, in steps of 2^(1/4), one level of Karatsuba is timed against schoolbook
+ * and one level of Toom-3 against one level of Karatsuba. Sub-products use the default thresholds, as in `mulN()`.
+ * A threshold is the smallest size from which the faster method wins at all larger sizes.
+ * Toom-3 is only a few percent ahead of Karatsuba over a wide range, so each size is judged on the median of 5 neighbours.
+ * Nanoseconds per multiply of each size and the thresholds are written as JSON object, the thresholds also on stderr.
+ *
+ * @param {number} runs - number of runs per measurement, the best counts
+ * @return {number} - 0 on success
+ */
+int sweep(unsigned runs) {
+	enum {
+		MAXLIMBS = 2048,
+		NUMSIZES = 37, // 4 * 2^(k/4) up to `MAXLIMBS`
+	};
+
+	uint64_t *pA = (uint64_t *) malloc(MAXLIMBS * sizeof *pA);
+	uint64_t *pB = (uint64_t *) malloc(MAXLIMBS * sizeof *pB);
+	uint64_t *pR = (uint64_t *) malloc(3 * 2 * MAXLIMBS * sizeof *pR);
+	if (!pA || !pB || !pR) {
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+	for (unsigned i = 0; i < MAXLIMBS; i++) {
+		pA[i] = xorshift64();
+		pB[i] = xorshift64();
+	}
+
+	// 2^(k/4) in thousandths
+	static const unsigned steps[4] = {1000, 1189, 1414, 1682};
+
+	BIGMUL mul;
+	unsigned sizes[NUMSIZES];
+	double seconds[NUMSIZES][3];
+
+	printf("\n  \"bigmul\": {\n    \"sizes\": [");
+	for (unsigned k = 0; k < NUMSIZES; k++) {
+		unsigned n = sizes[k] = ((4U << k / 4) * steps[k % 4] + 500) / 1000;
+
+		// all methods on all sizes, Toom-3 needs 7 limbs
+		for (unsigned method = 0; method < 3; method++) {
+			seconds[k][method] = method < 2 || n >= 7 ? timeMul(mul, method, pR + method * 2 * n, pA, pB, n, runs) : 0;
+			if (seconds[k][method] && memcmp(pR, pR + method * 2 * n, 2 * n * sizeof *pR)) {
+				fprintf(stderr, "BIGMUL error. limbs=%u method=%u\n", n, method);
+				return 1;
+			}
+		}
+
+		printf("%s\n      {\"limbs\": %u, \"schoolbook_ns\": %.1f, \"karatsuba_ns\": %.1f, \"toom3_ns\": %.1f}",
+		       k ? "," : "", n, seconds[k][0] * 1e9, seconds[k][1] * 1e9, seconds[k][2] * 1e9);
+	}
+
+	// smallest size from which method `hi` stays ahead of `lo`, on the median of 5 neighbouring sizes against noise
+	unsigned threshold[3] = {0, 0, 0};
+	for (unsigned hi = 1; hi < 3; hi++) {
+		unsigned lo = hi - 1;
+		for (unsigned k = NUMSIZES; k--;) {
+			double window[5];
+			unsigned numWindow = 0;
+			for (unsigned j = k < 2 ? 0 : k - 2; j <= k + 2 && j < NUMSIZES; j++) {
+				// Toom-3 not measured counts as behind
+				double ratio = seconds[j][hi] ? seconds[j][hi] / seconds[j][lo] : 2;
+				unsigned i = numWindow++;
+				for (; i && window[i - 1] > ratio; i--)
+					window[i] = window[i - 1];
+				window[i] = ratio;
+			}
+			if (window[numWindow / 2] >= 1)
+				break;
+			threshold[hi] = sizes[k];
+		}
+	}
+
+	printf("\n    ],\n    \"thresholds\": {\"karatsuba\": %u, \"toom3\": %u, \"default_karatsuba\": %u, \"default_toom3\": %u}\n  }",
+	       threshold[1], threshold[2], BIGMUL::KARATSUBA, BIGMUL::TOOM3);
+	fprintf(stderr, "BIGMUL Karatsuba from %u limbs (default %u), Toom-3 from %u limbs (default %u)\n",
+		threshold[1], BIGMUL::KARATSUBA, threshold[2], BIGMUL::TOOM3);
+
+	free(pA);
+	free(pB);
+	free(pR);
+	return 0;
+}
+
+int main(int argc, char *argv[]) {
+	unsigned n = 1 << 16;
+	unsigned runs = 5;
+	bool onlySweep = false;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "n:r:t")) != -1) {
+		switch (opt) {
+		case 'n':
+			n = strtoul(optarg, NULL, 10);
+			break;
+		case 'r':
+			runs = strtoul(optarg, NULL, 10);
+			break;
+		case 't':
+			onlySweep = true;
+			break;
+		default:
+			n = 0;
+			break;
+		}
+	}
+	if (n < 2 || n > (1 << 22) || runs < 1 || optind != argc) {
+		fprintf(stderr, "usage: %s [-n <values>] [-r <runs>] [-t]\n"
+			"\t-n <values>\tvalues per dataset, default 65536, up to 4194304\n"
+			"\t-r <runs>\truns per measurement, the best counts, default 5\n"
+			"\t-t\t\tonly the sweep of BIGMUL thresholds\n", argv[0]);
+		return 1;
+	}
+
+	printf("{\n  \"kernel\": \"%s\",\n  \"values\": %u,\n  \"runs\": %u,\n  \"results\": [", kernels[kernelIndex].name, n, runs);
+	if (!onlySweep && (bench<2>(n, runs) || bench<3>(n, runs) || bench<4>(n, runs) || bench<5>(n, runs)
+		|| bench<6>(n, runs) || bench<7>(n, runs) || bench<8>(n, runs)))
+		return 1;
+	printf("\n  ],");
+	if (sweep(runs))
+		return 1;
+	printf("\n}\n");
+
+	return 0;
+}